@@ -0,0 +1,143 @@
+#include "CompiledGraph.h"
+
+#include <stdexcept>
+#include <algorithm>
+
+CompiledGraph::CompiledGraph() : hasSharedOperator(false), p(0){}
+
+// ### constructor ### /// /// ### constructor ### /// /// ### constructor ### /// /// ### constructor ### ///
+// ### constructor ### /// /// ### constructor ### /// /// ### constructor ### /// /// ### constructor ### ///
+// the node constraints (stored after the q edges in graph) are not included
+
+CompiledGraph::CompiledGraph(Graph const& graph)
+{
+  unsigned int p = graph.nb_states();
+  unsigned int q = graph.nb_edges();
+
+  kind.reserve(q);
+  for(unsigned int k = 0; k < q; k++)
+  {
+    Edge const& edge = graph.getEdge(k);
+    std::string edge_ctt = edge.getConstraint();
+    if(edge_ctt == "null"){kind.push_back(EDGE_NULL);}
+    else if(edge_ctt == "std"){kind.push_back(EDGE_STD);}
+    else if(edge_ctt == "up"){kind.push_back(EDGE_UP);}
+    else if(edge_ctt == "down"){kind.push_back(EDGE_DOWN);}
+    else{throw std::range_error("Unknown edge type: " + edge_ctt);}
+
+    state1.push_back(edge.getState1());
+    state2.push_back(edge.getState2());
+    parameter.push_back(edge.getParameter());
+    beta.push_back(edge.getBeta());
+    KK.push_back(edge.getKK());
+    aa.push_back(edge.getAA());
+  }
+
+  ///the up (down) edges leaving the same state use the same operator result (they only differ by gap, penalty or state2)
+  sharedOperator.assign(q, 0);
+  hasSharedOperator = false;
+  for(unsigned int k = 0; k < q; k++)
+  {
+    sharedOperator[k] = k;
+    if(kind[k] != EDGE_UP && kind[k] != EDGE_DOWN){continue;}
+    unsigned int j = 0;
+    while(!(kind[j] == kind[k] && state1[j] == state1[k])){j = j + 1;}
+    sharedOperator[k] = j;
+    if(j != k){hasSharedOperator = true;}
+  }
+
+  lastNull.assign(q, false);
+  for(unsigned int k = 0; k < q; k++)
+  {
+    if(kind[k] != EDGE_NULL){continue;}
+    unsigned int j = k + 1;
+    while((j < q) && !(kind[j] == EDGE_NULL && state1[j] == state1[k])){j = j + 1;}
+    lastNull[k] = (j == q);
+  }
+
+  hasStdOut.assign(p, false);
+  for(unsigned int k = 0; k < q; k++){if(kind[k] == EDGE_STD){hasStdOut[state1[k]] = true;}}
+
+  ///backtracking tables: all the rows of graph (with the node constraints), the last edge wins as in Graph
+  unsigned int nbR = graph.nb_rows();
+  this->p = p;
+  decay.assign(p, 1);
+  pairBeta.assign(p * p, 0);
+  nbUpDown.assign(p * p, 0);
+  upGap.assign(p * p, 0);
+  downGap.assign(p * p, 0);
+  hasUp.assign(p * p, false);
+  hasDown.assign(p * p, false);
+  lastGap.assign(p * p, 0);
+  nodeInterval.assign(p * p, Interval());
+  hasNode.assign(p * p, false);
+  for(unsigned int i = 0; i < nbR; i++)
+  {
+    Edge const& edge = graph.getEdge(i);
+    std::string edge_ctt = edge.getConstraint();
+    unsigned int s1 = edge.getState1();
+    unsigned int s2 = edge.getState2();
+    unsigned int s12 = s1 * p + s2;
+    if((s1 == s2) && (edge_ctt == "null")){decay[s1] = edge.getParameter();}
+    if(edge_ctt != "node"){pairBeta[s12] = edge.getBeta();}
+    if(edge_ctt == "up"){upGap[s12] = edge.getParameter(); hasUp[s12] = true; lastGap[s12] = edge.getParameter(); nbUpDown[s12] = nbUpDown[s12] + 1;}
+    if(edge_ctt == "down"){downGap[s12] = edge.getParameter(); hasDown[s12] = true; lastGap[s12] = edge.getParameter(); nbUpDown[s12] = nbUpDown[s12] + 1;}
+    if(edge_ctt == "node"){nodeInterval[s12] = Interval(edge.getMinn(), edge.getMaxx()); hasNode[s12] = true;}
+  }
+
+  ///incoming edges of each state: consecutive edges with state2 = s (graph sorted by state2)
+  firstIncoming.assign(p, 0);
+  lastIncoming.assign(p, 0);
+  unsigned int k = 0;
+  for(unsigned int s = 0; s < p; s++)
+  {
+    firstIncoming[s] = k;
+    while((k < q) && (state2[k] == s)){k = k + 1;}
+    lastIncoming[s] = k;
+  }
+}
+
+// ### get ### /// /// ### get ### /// /// ### get ### ////// ### get ### ///
+// ### get ### /// /// ### get ### /// /// ### get ### ////// ### get ### ///
+
+unsigned int CompiledGraph::nb_states() const {return(firstIncoming.size());}
+unsigned int CompiledGraph::nb_edges() const {return(kind.size());}
+
+double CompiledGraph::recursiveState(unsigned int s) const {return(decay[s]);}
+double CompiledGraph::findBeta(unsigned int s1, unsigned int s2) const {return(pairBeta[s1 * p + s2]);}
+
+// ### buildInterval ### /// /// ### buildInterval ### /// /// ### buildInterval ### /// /// ### buildInterval ### ///
+// ### buildInterval ### /// /// ### buildInterval ### /// /// ### buildInterval ### /// /// ### buildInterval ### ///
+
+template<typename CostModel>
+Interval CompiledGraph::buildInterval(double argmin, unsigned int s1, unsigned int s2, bool& out) const
+{
+  unsigned int s12 = s1 * p + s2;
+  Interval response = CostModel::cost_interval();
+  Interval inter = CostModel::cost_interval();
+
+  if(hasUp[s12] == true){response.setb(CostModel::cost_interShift(argmin, -upGap[s12]));}
+  if(hasDown[s12] == true){response.seta(CostModel::cost_interShift(argmin, downGap[s12]));}
+  if(hasNode[s12] == true){inter = nodeInterval[s12];}
+
+  if(nbUpDown[s12] == 2) /// abs (= up + down edges) case
+  {
+    out = true;
+    response.seta(CostModel::cost_interShift(argmin, - lastGap[s12]));
+    response.setb(CostModel::cost_interShift(argmin, lastGap[s12]));
+  }
+
+  response.seta(std::max(inter.geta(), response.geta()));
+  response.setb(std::min(inter.getb(), response.getb()));
+
+  return(response);
+}
+
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+
+template Interval CompiledGraph::buildInterval<MeanCost>(double argmin, unsigned int s1, unsigned int s2, bool& out) const;
+template Interval CompiledGraph::buildInterval<VarianceCost>(double argmin, unsigned int s1, unsigned int s2, bool& out) const;
+template Interval CompiledGraph::buildInterval<PoissonCost>(double argmin, unsigned int s1, unsigned int s2, bool& out) const;
+template Interval CompiledGraph::buildInterval<ExpCost>(double argmin, unsigned int s1, unsigned int s2, bool& out) const;
+template Interval CompiledGraph::buildInterval<NegbinCost>(double argmin, unsigned int s1, unsigned int s2, bool& out) const;
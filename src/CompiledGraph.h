@@ -0,0 +1,63 @@
+//  GPL-3 License
+// Copyright (c) 2019 Vincent Runge
+
+#ifndef COMPILEDGRAPH_H
+#define COMPILEDGRAPH_H
+
+#include "Graph.h"
+#include "Interval.h"
+#include "CostModel.h"
+
+#include <vector>
+
+/// the 4 types of edges used by the forward pass
+enum EdgeKind {EDGE_NULL, EDGE_STD, EDGE_UP, EDGE_DOWN};
+
+/// the q edges of a Graph decoded once for the forward pass of Omega (no string, no Edge copy)
+/// edge k has its parameters at index k of each array. Edges in the order of the Graph (increasing state2)
+/// + lookup tables for the backtracking, indexed by state or by the pair (s1, s2) at s1 * p + s2
+class CompiledGraph
+{
+  public:
+    CompiledGraph();
+    CompiledGraph(Graph const& graph);
+
+    unsigned int nb_states() const;
+    unsigned int nb_edges() const;
+
+    ///same results as the Graph functions of the same name, in O(1)
+    template<typename CostModel> Interval buildInterval(double argmin, unsigned int s1, unsigned int s2, bool& out) const;
+    double recursiveState(unsigned int s) const;
+    double findBeta(unsigned int s1, unsigned int s2) const;
+
+    std::vector<EdgeKind> kind; ///type of the edge
+    std::vector<unsigned int> state1;
+    std::vector<unsigned int> state2;
+    std::vector<double> parameter; ///always positive. decay (null edge) or gap (up and down edges)
+    std::vector<double> beta; ///penalty
+    std::vector<double> KK; ///robust parameters
+    std::vector<double> aa;
+
+    std::vector<unsigned int> sharedOperator; ///up or down edge k: first edge of same kind leaving state1[k] (k itself if none before). Other edges: k
+    bool hasSharedOperator; ///at least one edge k with sharedOperator[k] != k
+    std::vector<bool> lastNull; ///null edge k is the last null edge leaving state1[k]: it can take the Pieces of a released row
+    std::vector<bool> hasStdOut; ///a std edge leaves the state s: LP_ts[t][s] needs its minimum (updateMinimum)
+
+    std::vector<unsigned int> firstIncoming; ///edges k ending in the state s: firstIncoming[s] <= k < lastIncoming[s]
+    std::vector<unsigned int> lastIncoming;
+
+  private:
+    unsigned int p; ///number of states
+    std::vector<double> decay; ///decay of the null edge (s, s), 1 if none
+    std::vector<double> pairBeta; ///penalty of the last edge (s1, s2), 0 if none
+    std::vector<unsigned int> nbUpDown; ///number of up and down edges (s1, s2)
+    std::vector<double> upGap; ///gap of the last up edge (s1, s2)
+    std::vector<double> downGap; ///gap of the last down edge (s1, s2)
+    std::vector<bool> hasUp;
+    std::vector<bool> hasDown;
+    std::vector<double> lastGap; ///gap of the last up or down edge (s1, s2)
+    std::vector<Interval> nodeInterval; ///interval of the last node edge (s1, s2), empty Interval if none
+    std::vector<bool> hasNode;
+};
+
+#endif // COMPILEDGRAPH_H
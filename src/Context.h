@@ -0,0 +1,23 @@
+//  GPL-3 License
+// Copyright (c) 2019 Vincent Runge
+
+#ifndef CONTEXT_H
+#define CONTEXT_H
+
+///tolerance of the minimization: default m_epsilon of Context (crossing test of pieceGenerator)
+///and relative tolerance of the level sets of the cost models (double root of cost_intervalInterRoots, CostModel.h)
+static const double defaultEpsilon = 1e-12;
+
+/// parameters of one gfpop run, owned by Omega and given to the ListPiece operations
+/// there is no global state in the engine: Omega objects can run simultaneously in different threads
+/// (the cost model is a template parameter, see CostModel.h; the Pieces are stored in the ListPiece of each Omega)
+class Context
+{
+  public:
+    Context(double epsilon = defaultEpsilon, unsigned int nbThreads = 1) : m_epsilon(epsilon), m_nbThreads(nbThreads){}
+
+    double m_epsilon; ///tolerance on the intersection points of two Pieces in the minimization (pieceGenerator)
+    unsigned int m_nbThreads; ///number of threads of the forward pass (1 = serial). Same result for all values
+};
+
+#endif // CONTEXT_H
@@ -0,0 +1,735 @@
+//  GPL-3 License
+// Copyright (c) 2019 Vincent Runge
+
+#ifndef COSTMODEL_H
+#define COSTMODEL_H
+
+#include "Cost.h"
+#include "Interval.h"
+#include "Data.h"
+#include "Context.h"
+
+#include <math.h>
+#include <algorithm>
+
+//////////////
+//////////////
+////////////// COEFF + EVAL
+//////////////
+//////////////
+
+//####### coefficients #######////####### coefficients #######////####### coefficients #######//
+//####### coefficients #######////####### coefficients #######////####### coefficients #######//
+
+///mean cost = m_A*THETA^2 + m_B*THETA + constant
+///variance cost = m_A*THETA - m_B*log(THETA) + constant
+/// poisson cost = m_A*THETA - m_B*log(THETA) + constant
+/// exp cost = m_A*THETA - m_B*log(THETA) + constant
+/// negbin cost = - m_A*log(THETA) - m_B*log(1-THETA) + constant
+
+inline double* mean_coeff(Point const& pt)
+{
+  double* coeff = new double[3];
+  coeff[0] = pt.w;
+  coeff[1] = -2 * pt.w * pt.y;
+  coeff[2] = pt.w * pt.y * pt.y;
+  return(coeff);
+}
+
+inline double* variance_coeff(Point const& pt)
+{
+  double* coeff = new double[3];
+  coeff[0] = pt.w * pt.y * pt.y;
+  coeff[1] = pt.w;
+  //coeff[2] = log(2 * M_PI);
+  coeff[2] = 0;
+  return(coeff);
+}
+
+inline double* poisson_coeff(Point const& pt)
+{
+  double* coeff = new double[3];
+  coeff[0] = pt.w;
+  coeff[1] = pt.w * pt.y;
+  //coeff[2] = log_factorial(y);
+  coeff[2] = 0;
+  return(coeff);
+}
+
+inline double* exp_coeff(Point const& pt)
+{
+  double* coeff = new double[3];
+  coeff[0] = pt.w * pt.y;
+  coeff[1] = pt.w;
+  coeff[2] = 0;
+  return(coeff);
+}
+
+inline double* negbin_coeff(Point const& pt)
+{
+  double* coeff = new double[3];
+  coeff[0] = pt.w;
+  coeff[1] = pt.w * pt.y;
+  coeff[2] = 0;
+  return(coeff);
+}
+
+//####### eval #######////####### eval #######////####### eval #######//
+//####### eval #######////####### eval #######////####### eval #######//
+/// NEVER = - INFINITY by construction
+
+inline double mean_eval(const Cost& cost, double value)
+{
+  double res = INFINITY; ///default case
+  if(value != -INFINITY && value != INFINITY){res = cost.m_A * value * value + cost.m_B * value + cost.constant;}
+  else if(cost.m_A == 0 && cost.m_B == 0){res = cost.constant;}
+  return(res);
+}
+
+inline double variance_eval(const Cost& cost, double value)
+{
+  double res = INFINITY; ///default case
+  if(value != 0 && value != INFINITY){res = cost.m_A * value - cost.m_B * log(value) + cost.constant;}
+  else if(value == 0 && cost.m_B == 0){res = cost.constant;}
+  else if(cost.m_A == 0 && cost.m_B == 0){res = cost.constant;}
+  return(res);
+}
+
+inline double negbin_eval(const Cost& cost, double value)
+{
+  double res = INFINITY; ///default case
+  if(value != 0 && value != 1){res = - cost.m_A * log(value) - cost.m_B * log(1 - value) + cost.constant;}
+  else if(value == 0 && cost.m_A == 0){res = cost.constant;}
+  else if(value  == 1 && cost.m_B == 0){res = cost.constant;}
+  else if(cost.m_A == 0 && cost.m_B == 0){res = cost.constant;}
+  return(res);
+}
+
+//////////////
+//////////////
+////////////// MIN + ARGMIN
+//////////////
+//////////////
+
+//####### minimum #######////####### minimum #######////####### minimum #######//
+//####### minimum #######////####### minimum #######////####### minimum #######//
+
+inline double mean_min(const Cost& cost)
+{
+  double res = -INFINITY;
+  if(cost.m_A > 0){res = - (cost.m_B * cost.m_B/(4 * cost.m_A)) + cost.constant;}
+  else if(cost.m_A == 0 && cost.m_B == 0){res = cost.constant;}
+  return(res);
+}
+
+inline double variance_min(const Cost& cost)
+{
+  double res = -INFINITY;
+  if(cost.m_A > 0 && cost.m_B > 0){res = cost.m_B - cost.m_B * log(cost.m_B/cost.m_A) + cost.constant;}
+  else if(cost.m_A >= 0 && cost.m_B == 0){res = cost.constant;}
+  return(res);
+}
+
+inline double negbin_min(const Cost& cost)
+{
+  double res = -INFINITY;
+  if(cost.m_A > 0 && cost.m_B > 0){res = - cost.m_A * log(cost.m_A/(cost.m_A + cost.m_B)) - cost.m_B * log(cost.m_B/(cost.m_A + cost.m_B)) + cost.constant;}
+  else if(cost.m_A == 0 || cost.m_B == 0){res = cost.constant;}
+  return(res);
+}
+
+
+//####### minInterval #######////####### minInterval #######////####### minInterval #######//
+//####### minInterval #######////####### minInterval #######////####### minInterval #######//
+
+inline double mean_minInterval(const Cost& cost, Interval inter)
+{
+  double minimum = -INFINITY;
+  //case m_A > 0
+  if(cost.m_A > 0)
+  {
+    minimum = - (cost.m_B * cost.m_B/(4 * cost.m_A)) + cost.constant;
+    double argmin = - cost.m_B/(2 * cost.m_A);
+    if(argmin < inter.geta()){minimum = cost.m_A * inter.geta() * inter.geta() + cost.m_B * inter.geta() + cost.constant;}
+    if(argmin > inter.getb()){minimum = cost.m_A * inter.getb() * inter.getb() + cost.m_B * inter.getb() + cost.constant;}
+  }
+
+  //case m_A = 0 & m_B != 0
+  else if((cost.m_A == 0) && (cost.m_B != 0))
+  {
+    if(cost.m_B > 0){minimum = cost.m_B * inter.geta() + cost.constant;}
+      else{minimum = cost.m_B * inter.getb() + cost.constant;}
+  }
+  //case m_A = 0 & m_B = 0
+  else if((cost.m_A == 0) && (cost.m_B == 0)){minimum = cost.constant;}
+
+  return(minimum);
+}
+
+
+inline double variance_minInterval(const Cost& cost, Interval inter)
+{
+  double minimum = -INFINITY;
+  //case m_A > 0 & cost.m_B > 0
+  if(cost.m_A > 0 && cost.m_B > 0)
+  {
+    minimum = cost.m_B - cost.m_B * log(cost.m_B/cost.m_A) + cost.constant;
+    double argmin = cost.m_B/cost.m_A;
+    if(argmin < inter.geta()){minimum = cost.m_A * inter.geta() - cost.m_B * log(inter.geta()) + cost.constant;}
+    if(argmin > inter.getb()){minimum = cost.m_A * inter.getb() - cost.m_B * log(inter.getb()) + cost.constant;}
+  }
+  //case m_A != 0 & m_B = 0
+  else if((cost.m_A != 0) && (cost.m_B == 0))
+  {
+    if(cost.m_A > 0){minimum = cost.m_A * inter.geta() + cost.constant;}
+      else{minimum = cost.m_A * inter.getb() + cost.constant;}
+  }
+  //case m_A = 0 & m_B = 0
+  else if((cost.m_A == 0) && (cost.m_B == 0)){minimum = cost.constant;}
+
+  return(minimum);
+}
+
+
+inline double negbin_minInterval(const Cost& cost, Interval inter)
+{
+  double minimum = -INFINITY;
+  //case m_A > 0 & cost.m_B > 0
+  if(cost.m_A > 0 && cost.m_B > 0)
+  {
+    minimum = - cost.m_A * log(cost.m_A/(cost.m_A + cost.m_B)) - cost.m_B * log(cost.m_B/(cost.m_A + cost.m_B)) + cost.constant;
+    double argmin = cost.m_A/(cost.m_A + cost.m_B);
+    if(argmin < inter.geta()){minimum = - cost.m_A * log(inter.geta()) - cost.m_B * log(1 - inter.geta()) + cost.constant;}
+    if(argmin > inter.getb()){minimum = - cost.m_A * log(inter.getb()) - cost.m_B * log(1 - inter.getb()) + cost.constant;}
+  }
+  else if(cost.m_A > 0 && cost.m_B == 0){minimum = - cost.m_A * log(inter.getb()) + cost.constant;}
+  else if(cost.m_A == 0 && cost.m_B > 0){minimum = - cost.m_B * log(1 - inter.geta()) + cost.constant;}
+  else if((cost.m_A == 0) && (cost.m_B == 0)){minimum = cost.constant;}
+
+  return(minimum);
+}
+
+//####### argmin #######////####### argmin #######////####### argmin #######//
+//####### argmin #######////####### argmin #######////####### argmin #######//
+
+inline double mean_argmin(const Cost& cost)
+{
+  double argmin = INFINITY;
+  if(cost.m_A == 0)
+  {
+    //if(m_B<=0){argmin = INFINITY;}
+    if(cost.m_B > 0){argmin = -INFINITY;}
+  }
+  else
+  {
+    argmin = - cost.m_B/(2 * cost.m_A);
+  }
+  return(argmin);
+}
+
+inline double variance_argmin(const Cost& cost)
+{
+  double argmin = INFINITY;
+  if(cost.m_B == 0)
+  {
+    //if(m_A <= 0){argmin = INFINITY;}
+    if(cost.m_A > 0){argmin = 0;}
+  }
+  else
+  {
+    argmin = cost.m_B/cost.m_A;
+  }
+  return(1/argmin); ///for the variance parameter
+}
+
+
+inline double poisson_argmin(const Cost& cost)
+{
+  double argmin = INFINITY;
+  if(cost.m_B == 0)
+  {
+    //if(m_A <= 0){argmin = INFINITY;}
+    if(cost.m_A > 0){argmin = 0;}
+  }
+  else if(cost.m_A != 0)
+  {
+    argmin = cost.m_B/cost.m_A; ///for the functional cost parameter
+  }
+  return(argmin);
+}
+
+
+inline double negbin_argmin(const Cost& cost)
+{
+  double argmin = 0.5;
+  if(cost.m_A > 0 && cost.m_B > 0){argmin = cost.m_A/(cost.m_A + cost.m_B);}
+  else if(cost.m_A > 0 && cost.m_B == 0){argmin = 1;}
+  else if(cost.m_A == 0 && cost.m_B > 0){argmin = 0;}
+  return(argmin);
+}
+
+//####### argminInterval #######////####### argminInterval #######////####### argminInterval #######//
+//####### argminInterval #######////####### argminInterval #######////####### argminInterval #######//
+
+inline double mean_argminInterval(const Cost& cost, Interval inter)
+{
+  double argmin = inter.getb();
+  if(cost.m_A == 0)
+  {
+    if(cost.m_B == 0){argmin = (inter.geta() + inter.getb())/2;}
+    else if(cost.m_B > 0){argmin = inter.geta();}
+  }
+  else
+  {
+    argmin = - cost.m_B/(2 * cost.m_A);
+    if(argmin < inter.geta()){argmin = inter.geta();}
+    else if(argmin > inter.getb()){argmin = inter.getb();}
+  }
+  return(argmin);
+}
+
+inline double variance_argminInterval(const Cost& cost, Interval inter)
+{
+  double argmin = inter.getb();
+  if(cost.m_B == 0)
+  {
+    if(cost.m_A == 0){argmin = (inter.geta() + inter.getb())/2;}
+    else if(cost.m_A > 0){argmin = inter.geta();}
+  }
+  else
+  {
+    argmin = cost.m_B/cost.m_A;
+    if(argmin < inter.geta()){argmin = inter.geta();}
+    else if(argmin > inter.getb()){argmin = inter.getb();}
+  }
+  return(1/argmin); ///for the variance parameter
+}
+
+
+inline double poisson_argminInterval(const Cost& cost, Interval inter)
+{
+  double argmin = inter.getb();
+  if(cost.m_B == 0)
+  {
+    if(cost.m_A == 0){argmin = (inter.geta() + inter.getb())/2;}
+    else if(cost.m_A > 0){argmin = inter.geta();}
+  }
+  else
+  {
+    argmin = cost.m_B/cost.m_A;
+    if(argmin < inter.geta()){argmin = inter.geta();}
+    else if(argmin > inter.getb()){argmin = inter.getb();}
+  }
+  return(argmin);
+}
+
+
+inline double negbin_argminInterval(const Cost& cost, Interval inter)
+{
+  double argmin = inter.getb();
+  if(cost.m_A > 0 && cost.m_B > 0)
+  {
+    argmin = cost.m_A/(cost.m_A + cost.m_B);
+    if(argmin < inter.geta()){argmin = inter.geta();}
+    else if(argmin > inter.getb()){argmin = inter.getb();}
+  }
+
+  else if(cost.m_A > 0 && cost.m_B == 0){argmin = inter.getb();}
+  else if(cost.m_A == 0 && cost.m_B > 0){argmin = inter.geta();}
+  else if(cost.m_A == 0 && cost.m_B == 0){argmin = (inter.geta() + inter.getb())/2;}
+  return(argmin);
+}
+//////////////
+//////////////
+////////////// TRANSFORMATIONS
+//////////////
+//////////////
+
+//####### shift #######////####### shift #######////####### shift #######//
+//####### shift #######////####### shift #######////####### shift #######//
+
+inline void mean_shift(Cost& cost, double parameter)
+{
+  cost.m_B = cost.m_B - 2 * cost.m_A * parameter;
+  cost.constant = cost.constant + parameter * (cost.m_A * parameter - cost.m_B);
+}
+
+inline void variance_shift(Cost& cost, double parameter)
+{
+  if(parameter > 0)
+  {
+    cost.m_A = cost.m_A / parameter;
+    cost.constant = cost.constant + cost.m_B * log(parameter);
+  }
+  if(parameter < 0)
+  {
+    cost.m_A = cost.m_A * fabs(parameter);
+    cost.constant = cost.constant - cost.m_B * log(fabs(parameter));
+  }
+}
+
+inline void negbin_shift(Cost& cost, double parameter){}
+
+
+//####### interShift #######////####### interShift #######////####### interShift #######//
+//####### interShift #######////####### interShift #######////####### interShift #######//
+
+inline double mean_interShift(double bound, double parameter)
+{
+  return(bound + parameter);
+}
+
+inline double variance_interShift(double bound, double parameter)
+{
+  double res = bound;
+  if(parameter > 0){res = bound * parameter;}
+  if(parameter < 0){res = bound / fabs(parameter);}
+  return(res);
+}
+
+inline double negbin_interShift(double bound, double parameter){return(bound);}
+
+
+
+//####### expDecay #######////####### expDecay #######////####### expDecay #######//
+//####### expDecay #######////####### expDecay #######////####### expDecay #######//
+
+inline void mean_expDecay(Cost& cost, double gamma)
+{
+  cost.m_A = cost.m_A / (gamma * gamma);
+  cost.m_B = cost.m_B / gamma;
+}
+
+inline void variance_expDecay(Cost& cost, double gamma)
+{
+  cost.m_A = cost.m_A / gamma;
+  cost.constant = cost.constant + cost.m_B * log(gamma);
+}
+
+inline void negbin_expDecay(Cost& cost, double gamma){}
+
+
+
+//####### interExpDecay #######////####### interExpDecay #######////####### interExpDecay #######//
+//####### interExpDecay #######////####### interExpDecay #######////####### interExpDecay #######//
+
+inline double mean_interExpDecay(double bound, double gamma)
+{
+  return(bound * gamma);
+}
+
+inline double variance_interExpDecay(double bound, double gamma)
+{
+  return(bound * gamma);
+}
+
+inline double negbin_interExpDecay(double bound, double gamma){return(bound);}
+
+
+//####### intervalInterRoots #######////####### intervalInterRoots #######////####### intervalInterRoots #######//
+//####### intervalInterRoots #######////####### intervalInterRoots #######////####### intervalInterRoots #######//
+
+//####### MEAN #######////
+inline Interval mean_intervalInterRoots(const Cost& cost, double& level)
+{
+  Interval newElement = Interval();
+  double Delta = cost.m_B * cost.m_B - 4 * cost.m_A * (cost.constant - level);
+
+  if(Delta > 0)
+  {
+    double R = sqrt(Delta);
+    newElement = Interval((- cost.m_B - R)/(2 * cost.m_A), (- cost.m_B + R)/(2 * cost.m_A));
+  }
+
+  return(newElement);
+}
+
+//####### roots of THETA - log(THETA) = 1 + a #######////
+/// a > 0. THETA = - W(- exp(- 1 - a)) with the Lambert W function: branch W_0 for the left root (< 1), W_-1 for the right root (> 1)
+/// first value: series at the branch point (a < 1) or asymptotic expansion of W, then Halley steps (1 or 2 in practice)
+/// relative error close to the machine precision. leftLog = log(left root) (the left root underflows for large a)
+
+inline double lambert_branchSeries(double s)
+{
+  ///THETA = 1 + s + s^2/3 + s^3/36 - s^4/270 + ... with s = sqrt(2a) (right root) or - sqrt(2a) (left root)
+  return(1 + s*(1 + s*(1.0/3 + s*(1.0/36 + s*(-1.0/270 + s*(1.0/4320 + s*(1.0/17010 + s*(-139.0/5443200 + s/204120))))))));
+}
+
+inline void lambert_roots(double a, double& leftLog, double& rightRoot)
+{
+  double c = 1 + a;
+  double x; ///right root
+  double y; ///log of the left root
+
+  if(a < 1)
+  {
+    double s = sqrt(2 * a);
+    x = lambert_branchSeries(s);
+    y = log(lambert_branchSeries(-s));
+  }
+  else
+  {
+    x = c + log(c + log(c + log(c)));
+    y = - c + exp(- c + exp(- c));
+  }
+
+  if(a >= 0.0001) ///below, the series is exact and the steps would only add rounding errors (f'(root) close to 0)
+  {
+    double f, f1, f2, step;
+    for(int i = 0; i < 4; i++) ///f(x) = x - log(x) - c
+    {
+      f = x - log(x) - c;
+      f1 = 1 - 1/x;
+      f2 = 1/(x * x);
+      step = 2 * f * f1/(2 * f1 * f1 - f * f2);
+      x = x - step;
+      if(fabs(step) <= 1e-15 * x){break;}
+    }
+    for(int i = 0; i < 4; i++) ///f(y) = exp(y) - y - c
+    {
+      f2 = exp(y);
+      f = f2 - y - c;
+      f1 = f2 - 1;
+      step = 2 * f * f1/(2 * f1 * f1 - f * f2);
+      y = y - step;
+      if(fabs(step) <= 1e-15 * fabs(y)){break;}
+    }
+  }
+
+  leftLog = y;
+  rightRoot = x;
+}
+
+//####### VARIANCE #######////
+inline Interval variance_intervalInterRoots(const Cost& cost, double& level)
+{
+  Interval newElement = Interval();
+
+  //roots of A THETA - B log THETA + C = 0
+  // <=> roots of THETA - log THETA = 1 + a
+  double U = cost.m_A/cost.m_B;
+  double a = -(((cost.constant - level)/cost.m_B) + log(U) + 1);
+  ///a within defaultEpsilon of its terms (rounding error, same tolerance as pieceGenerator): double root at the argmin 1/U
+  ///the roots are at U THETA = 1 +- sqrt(2a): the collapse replaces roots up to sqrt(2 noise) from the argmin (relative),
+  ///about 1.4e-6 for terms of order 1 (much more than the pieceGenerator epsilon on THETA)
+  double noise = defaultEpsilon * (fabs((cost.constant - level)/cost.m_B) + fabs(log(U)) + 1);
+
+  if(a > 0 && a <= noise)
+  {
+    newElement.seta(1/U);
+    newElement.setb(1/U);
+  }
+  else if(a > 0)
+  {
+    double leftRoot;
+    double rightRoot;
+    lambert_roots(a, leftRoot, rightRoot);
+
+    leftRoot = exp(leftRoot)/U;
+    rightRoot = rightRoot/U;
+
+    newElement.seta(leftRoot);
+    newElement.setb(rightRoot);
+    if(leftRoot >= rightRoot){newElement = Interval();}
+  }
+
+  return(newElement);
+}
+
+//####### POISSON #######////
+inline Interval poisson_intervalInterRoots(const Cost& cost, double& level)
+{
+  Interval newElement = Interval();
+
+  if(cost.m_B > 0)
+  {
+    newElement = variance_intervalInterRoots(cost, level);
+  }
+  else
+  {
+    newElement.seta(0);
+    newElement.setb(level - cost.constant);
+  }
+
+  return(newElement);
+}
+
+
+//####### negbin #######////
+/// roots of - A log(THETA) - B log(1-THETA) + C = level. With THETA = 1/(1 + exp(-v)) and p = A/(A+B):
+/// softplus(v) - p v = (level - C)/(A+B), softplus(v) = log(1 + exp(v)), convex in v with minimum H(p) = - p log(p) - (1-p) log(1-p)
+/// no closed form: Halley steps from the best of the quadratic (small a) and the asymptotic (large a) values, kept in the bracket of the root
+
+inline double negbin_softplus(double v){return(v > 0 ? v + log1p(exp(-v)) : log1p(exp(v)));}
+
+inline double negbin_logitRoot(double p, double level, double start, double lo, double hi)
+{
+  double v = start;
+  for(int i = 0; i < 50; i++)
+  {
+    double sigma = 1/(1 + exp(-v));
+    double f = negbin_softplus(v) - p * v - level;
+    double f1 = sigma - p;
+    double f2 = sigma * (1 - sigma);
+    if(f == 0){break;}
+    if((f > 0) == (f1 < 0)){lo = v;}else{hi = v;} ///f decreasing on the left root bracket, increasing on the right one
+    double next = v - 2 * f * f1/(2 * f1 * f1 - f * f2);
+    if(!(next > lo && next < hi)){next = (lo + hi)/2;} ///out of the bracket: bisection
+    double step = next - v;
+    v = next;
+    if(fabs(step) <= 1e-15 * (1 + fabs(v))){break;}
+  }
+  return(v);
+}
+
+inline Interval negbin_intervalInterRoots(const Cost& cost, double& level)
+{
+  Interval newElement = Interval();
+  if(!(cost.m_A * cost.m_B > 0)){return(newElement);}
+
+  double p = cost.m_A/(cost.m_A + cost.m_B);
+  double H = - p * log(p) - (1 - p) * log(1 - p);
+  double target = (level - cost.constant)/(cost.m_A + cost.m_B);
+  double a = target - H;
+  ///as for the variance: double root at the argmin p. The collapsed roots are at vMin +- sqrt(2a/(p(1-p))) in logit space
+  ///(quadratic approximation below), about 2.8e-6 for p = 1/2 and terms of order 1
+  double noise = defaultEpsilon * (fabs(target) + H);
+
+  if(a > 0 && a <= noise)
+  {
+    newElement.seta(p);
+    newElement.setb(p);
+  }
+  else if(a > 0)
+  {
+    double vMin = log(p/(1 - p));
+    double leftAsymptotic = - target/p; ///softplus(v) ~ 0
+    double rightAsymptotic = target/(1 - p); ///softplus(v) ~ v
+    double width = sqrt(2 * a/(p * (1 - p))); ///quadratic approximation at vMin
+
+    double leftStart = std::max(leftAsymptotic, vMin - width);
+    double rightStart = std::min(rightAsymptotic, vMin + width);
+    double leftRoot = negbin_logitRoot(p, target, leftStart, leftAsymptotic, vMin);
+    double rightRoot = negbin_logitRoot(p, target, rightStart, vMin, rightAsymptotic);
+
+    leftRoot = 1/(1 + exp(-leftRoot));
+    rightRoot = 1/(1 + exp(-rightRoot));
+
+    newElement.seta(leftRoot);
+    newElement.setb(rightRoot);
+    if(leftRoot >= rightRoot){newElement = Interval();}
+  }
+
+  return(newElement);
+}
+
+
+//####### ages #######////####### ages #######////####### ages #######//
+//####### ages #######////####### ages #######////####### ages #######//
+
+inline int mean_age(const Cost& cost){return((int) cost.m_A);}
+inline int variance_age(const Cost& cost){return((int) cost.m_B);}
+inline int poisson_age(const Cost& cost){return((int) cost.m_A);}
+inline int exp_age(const Cost& cost){return((int) cost.m_B);}
+inline int negbin_age(const Cost& cost){return((int) cost.m_A);}
+
+
+//####### intervals #######////####### intervals #######////####### intervals #######//
+//####### intervals #######////####### intervals #######////####### intervals #######//
+
+inline Interval mean_interval(){return(Interval(-INFINITY,INFINITY));}
+inline Interval variance_interval(){return(Interval(0,INFINITY));}
+inline Interval negbin_interval(){return(Interval(0,1));}
+
+
+//////////////
+//////////////
+////////////// COST MODELS
+//////////////
+//////////////
+
+//####### cost models #######////####### cost models #######////####### cost models #######//
+//####### cost models #######////####### cost models #######////####### cost models #######//
+/// the cost functions of a data type, chosen at compile time: Piece, ListPiece and Omega
+/// are templates on one of these structures (selected once by the type string in gfpopTransfer)
+
+struct MeanCost
+{
+  static double* cost_coeff(Point const& pt){return(mean_coeff(pt));}
+  static double cost_eval(const Cost& cost, double value){return(mean_eval(cost, value));}
+
+  static double cost_min(const Cost& cost){return(mean_min(cost));}
+  static double cost_minInterval(const Cost& cost, Interval inter){return(mean_minInterval(cost, inter));}
+  static double cost_argmin(const Cost& cost){return(mean_argmin(cost));}
+  static double cost_argminInterval(const Cost& cost, Interval inter){return(mean_argminInterval(cost, inter));}
+  static double cost_argminBacktrack(const Cost& cost, Interval inter){return(mean_argminInterval(cost, inter));}
+
+  static void cost_shift(Cost& cost, double parameter){mean_shift(cost, parameter);}
+  static double cost_interShift(double bound, double parameter){return(mean_interShift(bound, parameter));}
+  static void cost_expDecay(Cost& cost, double gamma){mean_expDecay(cost, gamma);}
+  static double cost_interExpDecay(double bound, double gamma){return(mean_interExpDecay(bound, gamma));}
+
+  static Interval cost_intervalInterRoots(const Cost& cost, double& level){return(mean_intervalInterRoots(cost, level));}
+  static int cost_age(const Cost& cost){return(mean_age(cost));}
+  static Interval cost_interval(){return(mean_interval());}
+};
+
+struct VarianceCost
+{
+  static double* cost_coeff(Point const& pt){return(variance_coeff(pt));}
+  static double cost_eval(const Cost& cost, double value){return(variance_eval(cost, value));}
+
+  static double cost_min(const Cost& cost){return(variance_min(cost));}
+  static double cost_minInterval(const Cost& cost, Interval inter){return(variance_minInterval(cost, inter));}
+  static double cost_argmin(const Cost& cost){return(poisson_argmin(cost));}
+  static double cost_argminInterval(const Cost& cost, Interval inter){return(poisson_argminInterval(cost, inter));}
+  static double cost_argminBacktrack(const Cost& cost, Interval inter){return(variance_argminInterval(cost, inter));}
+
+  static void cost_shift(Cost& cost, double parameter){variance_shift(cost, parameter);}
+  static double cost_interShift(double bound, double parameter){return(variance_interShift(bound, parameter));}
+  static void cost_expDecay(Cost& cost, double gamma){variance_expDecay(cost, gamma);}
+  static double cost_interExpDecay(double bound, double gamma){return(variance_interExpDecay(bound, gamma));}
+
+  static Interval cost_intervalInterRoots(const Cost& cost, double& level){return(variance_intervalInterRoots(cost, level));}
+  static int cost_age(const Cost& cost){return(variance_age(cost));}
+  static Interval cost_interval(){return(variance_interval());}
+};
+
+/// poisson and exp: same functional cost as variance (A*THETA - B*log(THETA) + C), other parameter
+struct PoissonCost : public VarianceCost
+{
+  static double* cost_coeff(Point const& pt){return(poisson_coeff(pt));}
+  static double cost_argminBacktrack(const Cost& cost, Interval inter){return(poisson_argminInterval(cost, inter));}
+  static Interval cost_intervalInterRoots(const Cost& cost, double& level){return(poisson_intervalInterRoots(cost, level));}
+  static int cost_age(const Cost& cost){return(poisson_age(cost));}
+};
+
+struct ExpCost : public VarianceCost
+{
+  static double* cost_coeff(Point const& pt){return(exp_coeff(pt));}
+  static double cost_argminBacktrack(const Cost& cost, Interval inter){return(poisson_argminInterval(cost, inter));}
+  static int cost_age(const Cost& cost){return(exp_age(cost));}
+};
+
+struct NegbinCost
+{
+  static double* cost_coeff(Point const& pt){return(negbin_coeff(pt));}
+  static double cost_eval(const Cost& cost, double value){return(negbin_eval(cost, value));}
+
+  static double cost_min(const Cost& cost){return(negbin_min(cost));}
+  static double cost_minInterval(const Cost& cost, Interval inter){return(negbin_minInterval(cost, inter));}
+  static double cost_argmin(const Cost& cost){return(negbin_argmin(cost));}
+  static double cost_argminInterval(const Cost& cost, Interval inter){return(negbin_argminInterval(cost, inter));}
+  static double cost_argminBacktrack(const Cost& cost, Interval inter){return(negbin_argminInterval(cost, inter));}
+
+  static void cost_shift(Cost& cost, double parameter){negbin_shift(cost, parameter);}
+  static double cost_interShift(double bound, double parameter){return(negbin_interShift(bound, parameter));}
+  static void cost_expDecay(Cost& cost, double gamma){negbin_expDecay(cost, gamma);}
+  static double cost_interExpDecay(double bound, double gamma){return(negbin_interExpDecay(bound, gamma));}
+
+  static Interval cost_intervalInterRoots(const Cost& cost, double& level){return(negbin_intervalInterRoots(cost, level));}
+  static int cost_age(const Cost& cost){return(negbin_age(cost));}
+  static Interval cost_interval(){return(negbin_interval());}
+};
+
+#endif // COSTMODEL_H
@@ -15,6 +15,8 @@ double Edge::getAA() const {return(aa);}
 double Edge::getMinn() const {return(minn);}
 double Edge::getMaxx() const {return(maxx);}
 
+void Edge::scaleBeta(double multiplier){beta = beta * fabs(multiplier);}
+
 void Edge::show() const
 {
   //std::cout << "- s1: " << state1 << " s2: " << state2 << " cstt: " << constraint << " param: " << parameter << " beta: " << beta;
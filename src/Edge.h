@@ -21,6 +21,8 @@ class Edge
     double getMinn() const;
     double getMaxx() const;
 
+    void scaleBeta(double multiplier);
+
     void show() const;
 
   private:
@@ -6,29 +6,23 @@
 
 Graph::Graph(){}
 
-void Graph::newEdge(Edge const& edge){edges.push_back(edge);}
+void Graph::newEdge(Edge const& edge){edges.push_back(edge); addStates(edge);}
 
-// ### nb_states ### /// /// ### nb_states ### /// /// ### nb_states ### /// /// ### nb_states ### ///
-// ### nb_states ### /// /// ### nb_states ### /// /// ### nb_states ### /// /// ### nb_states ### ///
-
-unsigned int Graph::nb_states() const
+void Graph::addStates(Edge const& edge)
 {
-  std::vector<unsigned int> temp;
-  for (std::vector<Edge>::const_iterator it=edges.begin() ; it < edges.end() ; it++)
-  {
-    temp.push_back(it->getState1());
-    temp.push_back(it->getState2());
-  }
-  sort(temp.begin(), temp.end());
-
-  unsigned int res = 1;
-  for(unsigned int j = 0; j < temp.size() - 1 ; j++)
+  unsigned int s[2] = {edge.getState1(), edge.getState2()};
+  for(unsigned int i = 0; i < 2; i++)
   {
-    if(temp[j] != temp[j + 1]){res = res + 1;}
+    std::vector<unsigned int>::iterator it = std::lower_bound(states.begin(), states.end(), s[i]);
+    if(it == states.end() || *it != s[i]){states.insert(it, s[i]);}
   }
-  return(res);
 }
 
+// ### nb_states ### /// /// ### nb_states ### /// /// ### nb_states ### /// /// ### nb_states ### ///
+// ### nb_states ### /// /// ### nb_states ### /// /// ### nb_states ### /// /// ### nb_states ### ///
+
+unsigned int Graph::nb_states() const {return(states.size());}
+
 
 // ### nb_edges ### /// /// ### nb_edges ### /// /// ### nb_edges ### /// /// ### nb_edges ### ///
 // ### nb_edges ### /// /// ### nb_edges ### /// /// ### nb_edges ### /// /// ### nb_edges ### ///
@@ -52,7 +46,7 @@ unsigned int Graph::nb_rows() const {return(edges.size());}
 // ### get ### /// /// ### get ### /// /// ### get ### ////// ### get ### ///
 // ### get ### /// /// ### get ### /// /// ### get ### ////// ### get ### ///
 
-Edge Graph::getEdge(unsigned int i) const {return(edges[i]);}
+Edge const& Graph::getEdge(unsigned int i) const {return(edges[i]);}
 std::vector<unsigned int> Graph::getStartState() const {return(startState);}
 std::vector<unsigned int> Graph::getEndState() const {return(endState);}
 
@@ -60,20 +54,21 @@ std::vector<unsigned int> Graph::getEndState() const {return(endState);}
 // ### buildInterval ### /// /// ### buildInterval ### /// /// ### buildInterval ### /// /// ### buildInterval ### ///
 // ### buildInterval ### /// /// ### buildInterval ### /// /// ### buildInterval ### /// /// ### buildInterval ### ///
 
+template<typename CostModel>
 Interval Graph::buildInterval(double argmin, unsigned int s1, unsigned int s2, bool& out) const
 {
-  Interval response = cost_interval();
+  Interval response = CostModel::cost_interval();
   unsigned int nb = 0;
   unsigned int edgeIndex;
-  Interval inter = cost_interval();
+  Interval inter = CostModel::cost_interval();
 
   for (unsigned int i = 0 ; i < edges.size() ; i++)
   {
     if((edges[i].getState1() == s1) && (edges[i].getState2() == s2))
     {
-      cost_interShift(argmin, - edges[i].getParameter());
-      if(edges[i].getConstraint() == "up"){response.setb(cost_interShift(argmin, -edges[i].getParameter())); nb = nb + 1; edgeIndex = i;}
-      if(edges[i].getConstraint()  == "down"){response.seta(cost_interShift(argmin, edges[i].getParameter())); nb = nb + 1;  edgeIndex = i;}
+      CostModel::cost_interShift(argmin, - edges[i].getParameter());
+      if(edges[i].getConstraint() == "up"){response.setb(CostModel::cost_interShift(argmin, -edges[i].getParameter())); nb = nb + 1; edgeIndex = i;}
+      if(edges[i].getConstraint()  == "down"){response.seta(CostModel::cost_interShift(argmin, edges[i].getParameter())); nb = nb + 1;  edgeIndex = i;}
       if(edges[i].getConstraint()  == "node"){inter = Interval(edges[i].getMinn(), edges[i].getMaxx());}
     }
   }
@@ -81,8 +76,8 @@ Interval Graph::buildInterval(double argmin, unsigned int s1, unsigned int s2, b
   if(nb == 2) /// abs (= up + down edges) case
   {
     out = true;
-    response.seta(cost_interShift(argmin, - edges[edgeIndex].getParameter()));
-    response.setb(cost_interShift(argmin, edges[edgeIndex].getParameter()));
+    response.seta(CostModel::cost_interShift(argmin, - edges[edgeIndex].getParameter()));
+    response.setb(CostModel::cost_interShift(argmin, edges[edgeIndex].getParameter()));
   }
 
   response.seta(std::max(inter.geta(), response.geta()));
@@ -127,12 +122,14 @@ double Graph::findBeta(unsigned int state1, unsigned int state2)
 // ### nodeConstraints ### /// /// ### nodeConstraints ### /// /// ### nodeConstraints ### /// /// ### nodeConstraints ### ///
 // ### nodeConstraints ### /// /// ### nodeConstraints ### /// /// ### nodeConstraints ### /// /// ### nodeConstraints ### ///
 
+template<typename CostModel>
 Interval* Graph::nodeConstraints()
 {
-  Interval* inter = new Interval[nb_states()];
-  for (unsigned int i = 0 ; i < nb_states(); i++)
+  unsigned int p = nb_states();
+  Interval* inter = new Interval[p];
+  for (unsigned int i = 0 ; i < p; i++)
   {
-    inter[i] = cost_interval();
+    inter[i] = CostModel::cost_interval();
   }
   for (unsigned int i = 0 ; i < edges.size(); i++)
   {
@@ -142,6 +139,18 @@ Interval* Graph::nodeConstraints()
 }
 
 
+// ### scalePenalties ### /// /// ### scalePenalties ### /// /// ### scalePenalties ### ///
+// ### scalePenalties ### /// /// ### scalePenalties ### /// /// ### scalePenalties ### ///
+// all the penalties multiplied by multiplier (penalty grid)
+
+void Graph::scalePenalties(double multiplier)
+{
+  for (unsigned int i = 0 ; i < edges.size() ; i++)
+  {
+    edges[i].scaleBeta(multiplier);
+  }
+}
+
 // ### show ### /// /// ### show ### /// /// ### show ### /// /// ### show ### ///
 // ### show ### /// /// ### show ### /// /// ### show ### /// /// ### show ### ///
 
@@ -174,7 +183,18 @@ void Graph::operator<<(Edge const& newEdge)
 {
   if(newEdge.getConstraint() == "start"){startState.push_back(newEdge.getState1());}
   if(newEdge.getConstraint() == "end"){endState.push_back(newEdge.getState1());}
-  if((newEdge.getConstraint() != "start") && (newEdge.getConstraint() != "end")){edges.push_back(newEdge);}
+  if((newEdge.getConstraint() != "start") && (newEdge.getConstraint() != "end")){edges.push_back(newEdge); addStates(newEdge);}
 }
 
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+
+#define GRAPH_INSTANTIATION(CostModel) \
+template Interval Graph::buildInterval<CostModel>(double argmin, unsigned int s1, unsigned int s2, bool& out) const; \
+template Interval* Graph::nodeConstraints<CostModel>();
 
+GRAPH_INSTANTIATION(MeanCost)
+GRAPH_INSTANTIATION(VarianceCost)
+GRAPH_INSTANTIATION(PoissonCost)
+GRAPH_INSTANTIATION(ExpCost)
+GRAPH_INSTANTIATION(NegbinCost)
@@ -6,7 +6,7 @@
 
 #include"Edge.h"
 #include"Interval.h"
-#include"ExternFunctions.h"
+#include"CostModel.h"
 
 #include<vector>
 #include<string>
@@ -24,14 +24,16 @@ class Graph
     unsigned int nb_edges() const;
     unsigned int nb_rows() const;
 
-    Edge getEdge(unsigned int i) const;
+    Edge const& getEdge(unsigned int i) const;
     std::vector<unsigned int> getStartState() const;
     std::vector<unsigned int> getEndState() const;
 
-    Interval buildInterval(double argmin, unsigned int s1, unsigned int s2, bool& out) const;
+    template<typename CostModel> Interval buildInterval(double argmin, unsigned int s1, unsigned int s2, bool& out) const;
     double recursiveState(unsigned int s) const;
     double findBeta(unsigned int state1, unsigned int state2);
-    Interval* nodeConstraints();
+    template<typename CostModel> Interval* nodeConstraints();
+
+    void scalePenalties(double multiplier);
 
     void show() const;
 
@@ -42,6 +44,9 @@ class Graph
     std::vector<Edge> edges; ///vector edges
     std::vector<unsigned int> startState;
     std::vector<unsigned int> endState;
+    std::vector<unsigned int> states; ///distinct states of the edges, sorted (nb_states = states.size())
+
+    void addStates(Edge const& edge);
 };
 
 #endif // GRAPH_H
@@ -2,340 +2,296 @@
 
 #include "Piece.h"
 #include <iostream>
+#include <algorithm>
 #include "stdlib.h"
 
 
-ListPiece::ListPiece()
-{
-  head = NULL;
-  currentPiece = NULL;
-  lastPiece = NULL;
-}
-
-ListPiece::~ListPiece()
-{
-  delete(head);
-  head = NULL;
-  currentPiece = NULL;
-  lastPiece = NULL;
-}
+template<typename CostModel>
+ListPiece<CostModel>::ListPiece() : globalMin(INFINITY), positionMin(1), hasPending(false), pendingShift(0), pendingDecay(1), hasPendingCost(false), pendingPenalty(0), nbMaterialized(0), lastMaterialized(false){}
 
 //##### setUniquePieceCostToInfinity #####//////##### setUniquePieceCostToInfinity #####//////##### setUniquePieceCostToInfinity #####///
 //##### setUniquePieceCostToInfinity #####//////##### setUniquePieceCostToInfinity #####//////##### setUniquePieceCostToInfinity #####///
 
-void ListPiece::setUniquePieceCostToInfinity()
+template<typename CostModel>
+void ListPiece<CostModel>::setUniquePieceCostToInfinity()
 {
-  head -> m_cost.constant = INFINITY;
+  pieces[0].m_cost.constant = INFINITY;
 }
 
 
 //##### setNewBounds #####//////##### setNewBounds #####//////##### setNewBounds #####///
 //##### setNewBounds #####//////##### setNewBounds #####//////##### setNewBounds #####///
 
-void ListPiece::setNewBounds(Interval newBounds)
+template<typename CostModel>
+void ListPiece<CostModel>::setNewBounds(Interval newBounds)
 {
   double a = newBounds.geta();
   double b = newBounds.getb();
-  Piece* tmp;
+  std::size_t tmp;
+
+  /// only the Pieces read here get their pending transformation (materialize)
 
   //left bound
-  if(a <= head -> m_interval.geta()){head -> m_interval.seta(a);}
+  materialize(0);
+  if(a <= pieces.front().m_interval.geta()){pieces.front().m_interval.seta(a);}
   else
   {
-    while(a > head -> m_interval.getb())
-    {
-      tmp = head;
-      head = head -> nxt;
-      tmp -> nxt = NULL;
-      delete(tmp);
-    }
-    head -> m_interval.seta(a);
+    tmp = 0;
+    while(a > pieces[tmp].m_interval.getb()){tmp = tmp + 1; materialize(tmp);}
+    pieces.erase(pieces.begin(), pieces.begin() + tmp);
+    if(hasPending == true){nbMaterialized = nbMaterialized - tmp;}
+    pieces.front().m_interval.seta(a);
   }
 
   //right bound
-  if(b >= lastPiece -> m_interval.getb()){lastPiece -> m_interval.setb(b);}
+  materializeLast();
+  if(b >= pieces.back().m_interval.getb()){pieces.back().m_interval.setb(b);}
   else
   {
-    tmp = head;
-    while(tmp -> m_interval.getb() < b){tmp = tmp -> nxt;}
-    tmp -> m_interval.setb(b);
-    if(tmp -> nxt != NULL){delete(tmp -> nxt); tmp -> nxt = NULL;}
-    lastPiece = tmp;
+    tmp = 0;
+    while(pieces[tmp].m_interval.getb() < b){tmp = tmp + 1; materialize(tmp);}
+    pieces[tmp].m_interval.setb(b);
+    pieces.erase(pieces.begin() + tmp + 1, pieces.end());
   }
 }
 
 //##### reset #####//////##### reset #####//////##### reset #####///
 //##### reset #####//////##### reset #####//////##### reset #####///
+/// the capacity of pieces is kept for the next time step
 
-void ListPiece::reset()
+template<typename CostModel>
+void ListPiece<CostModel>::reset()
 {
-  while(head != NULL)
-  {
-    Piece* pieceToDelete = head;
-    head = head -> nxt;
-    pieceToDelete -> nxt = NULL;
-    delete(pieceToDelete);
-  }
-  currentPiece = NULL;
-  lastPiece = NULL;
+  pieces.clear();
+  clearPending();
 }
 
 //##### copy #####//////##### copy #####//////##### copy #####///
 //##### copy #####//////##### copy #####//////##### copy #####///
 
-void ListPiece::copy(ListPiece const& LP_edge)
+template<typename CostModel>
+void ListPiece<CostModel>::copy(ListPiece<CostModel> const& LP_edge)
 {
-  Piece* tmp = LP_edge.head;
-  head = tmp -> copy();
-  currentPiece = head;
-  tmp = tmp -> nxt;
-
-  while(tmp != NULL)
-  {
-    currentPiece -> nxt = tmp -> copy(); //copy content in Piece
-    currentPiece = currentPiece -> nxt; //copy nxt pointer
-    tmp = tmp -> nxt;
-  }
-  lastPiece = currentPiece;
+  pieces = LP_edge.pieces;
+  clearPending();
 }
 
 
-//##### reverseAndCount #####//////##### reverseAndCount #####//////##### reverseAndCount #####///
-//##### reverseAndCount #####//////##### reverseAndCount #####//////##### reverseAndCount #####///
+//##### take #####//////##### take #####//////##### take #####///
+//##### take #####//////##### take #####//////##### take #####///
+/// null edge on a row deleted after the time step: the Pieces of LP_state are moved, not copied (LP_state is left unusable)
 
-void ListPiece::reverseAndCount(unsigned int& length)
+template<typename CostModel>
+void ListPiece<CostModel>::take(ListPiece<CostModel>& LP_state)
 {
-  lastPiece = head;
-
-  Piece* prev =  NULL;
-  Piece* current = head;
-  Piece* next = current;
-
-  while(current != NULL)
-  {
-    next  = current -> nxt;
-    current -> nxt = prev; /// new nxt
-    prev = current;
-    length = length + 1; ///add +1 to length
-    current = next;
-  }
-
-  head = prev;
-  currentPiece = head;
+  pieces.swap(LP_state.pieces);
+  clearPending();
 }
 
 
-//##### reverseAndSetTrackPosition #####//////##### reverseAndSetTrackPosition #####//////##### reverseAndSetTrackPosition #####///
-//##### reverseAndSetTrackPosition #####//////##### reverseAndSetTrackPosition #####//////##### reverseAndSetTrackPosition #####///
+//##### countChangepoints #####//////##### countChangepoints #####//////##### countChangepoints #####///
+//##### countChangepoints #####//////##### countChangepoints #####//////##### countChangepoints #####///
+// "cost" storage (no backtracking): the label of a Piece is the number of changepoints of its best segmentation
+// the Pieces of a non null edge (new segment) get the label of their parent Piece in LP_state + 1
 
-void ListPiece::reverseAndSetTrackPosition(unsigned int length)
+template<typename CostModel>
+void ListPiece<CostModel>::countChangepoints(ListPiece<CostModel> const& LP_state)
 {
-  lastPiece = head;
-
-  Piece* prev =  NULL;
-  Piece* tmp = head;
-  Piece* next = tmp;
-
-  while(tmp != NULL)
-  {
-    next  = tmp -> nxt;
-    tmp -> nxt = prev; /// new nxt
-    prev = tmp;
-    tmp -> m_info.reversePosition(length);
-    tmp = next;
-  }
-
-  head = prev;
-  currentPiece = head;
+  for(std::size_t i = 0; i < pieces.size(); i++)
+    {pieces[i].m_info.setLabel(LP_state.pieces[pieces[i].m_info.getPosition() - 1].m_info.getLabel() + 1);}
 }
 
 
-//##### addCurrentPiecePlus1NotMove #####//////##### addCurrentPiecePlus1NotMove #####//////##### addCurrentPiecePlus1NotMove #####///
-//##### addCurrentPiecePlus1NotMove #####//////##### addCurrentPiecePlus1NotMove #####//////##### addCurrentPiecePlus1NotMove #####///
-
-void ListPiece::addCurrentPiecePlus1NotMove(Piece* newPiece)
-{
-  newPiece -> nxt = currentPiece -> nxt;
-  currentPiece -> nxt = newPiece;
-}
-
 //##### addFirstPiece #####//////##### addFirstPiece #####//////##### addFirstPiece #####///
 //##### addFirstPiece #####//////##### addFirstPiece #####//////##### addFirstPiece #####///
 
-void ListPiece::addFirstPiece(Piece* newPiece)
+template<typename CostModel>
+void ListPiece<CostModel>::addFirstPiece(Piece<CostModel> const& newPiece)
 {
-  head = newPiece;
-  currentPiece = newPiece;
-  lastPiece = newPiece;
+  pieces.assign(1, newPiece);
 }
 
-//##### move #####//////##### move #####//////##### move #####///
-//##### move #####//////##### move #####//////##### move #####///
 
-void ListPiece::move()
+//##### shift #####//////##### shift #####//////##### shift #####///
+//##### shift #####//////##### shift #####//////##### shift #####///
+/// pending: the bounds and costs of the Pieces are moved by materialize
+
+template<typename CostModel>
+void ListPiece<CostModel>::shift(double parameter)
 {
-  currentPiece = currentPiece -> nxt;
+  pendingShift = parameter;
+  hasPending = true;
 }
 
-//##### initializeCurrentPiece #####//////##### initializeCurrentPiece #####//////##### initializeCurrentPiece #####///
-//##### initializeCurrentPiece #####//////##### initializeCurrentPiece #####//////##### initializeCurrentPiece #####///
 
-void ListPiece::initializeCurrentPiece()
+//##### expDecay #####//////##### expDecay #####//////##### expDecay #####///
+//##### expDecay #####//////##### expDecay #####//////##### expDecay #####///
+/// pending: the bounds and costs of the Pieces are moved by materialize
+
+template<typename CostModel>
+void ListPiece<CostModel>::expDecay(double gamma)
 {
-  currentPiece = head;
+  pendingDecay = gamma;
+  hasPending = true;
 }
 
 
-//##### shift #####//////##### shift #####//////##### shift #####///
-//##### shift #####//////##### shift #####//////##### shift #####///
+//##### materialize #####//////##### materialize #####//////##### materialize #####///
+//##### materialize #####//////##### materialize #####//////##### materialize #####///
+/// LP_edges: the pending shift or decay (LP_edges_parameter), then the pending cost (LP_edges_addPointAndPenalty)
+/// are applied to the Pieces 0..i not done yet. The Pieces are reached in increasing order, except the last one (setNewBounds)
 
-void ListPiece::shift(double parameter)
+template<typename CostModel>
+void ListPiece<CostModel>::materialize(std::size_t i)
 {
-  Interval inter;
-  initializeCurrentPiece();
-  while(currentPiece != NULL)
+  if(hasPending == false){return;}
+  while(nbMaterialized <= i)
   {
-    ///MOVE bounds
-    inter = currentPiece -> m_interval;
-    currentPiece -> m_interval.seta(cost_interShift(inter.geta(), parameter));
-    currentPiece -> m_interval.setb(cost_interShift(inter.getb(), parameter));
-    ///MOVE Cost
-    cost_shift(currentPiece -> m_cost, parameter);
-    move();
+    if(!(lastMaterialized == true && nbMaterialized + 1 == pieces.size())){materializePiece(pieces[nbMaterialized]);}
+    nbMaterialized = nbMaterialized + 1;
   }
 }
 
+template<typename CostModel>
+void ListPiece<CostModel>::materializeLast()
+{
+  if(hasPending == false || lastMaterialized == true || nbMaterialized == pieces.size()){return;}
+  materializePiece(pieces.back());
+  lastMaterialized = true;
+}
 
-//##### expDecay #####//////##### expDecay #####//////##### expDecay #####///
-//##### expDecay #####//////##### expDecay #####//////##### expDecay #####///
-
-void ListPiece::expDecay(double gamma)
+template<typename CostModel>
+void ListPiece<CostModel>::materializePiece(Piece<CostModel>& piece) const
 {
-  Interval inter;
-  initializeCurrentPiece();
-  while(currentPiece != NULL)
+  Interval inter = piece.m_interval;
+  if(pendingShift != 0)
   {
     ///MOVE bounds
-    inter = currentPiece -> m_interval;
-    currentPiece -> m_interval.seta(cost_interExpDecay(inter.geta(), gamma));
-    currentPiece -> m_interval.setb(cost_interExpDecay(inter.getb(), gamma));
+    piece.m_interval.seta(CostModel::cost_interShift(inter.geta(), pendingShift));
+    piece.m_interval.setb(CostModel::cost_interShift(inter.getb(), pendingShift));
     ///MOVE Cost
-    cost_expDecay(currentPiece -> m_cost, gamma);
-    move();
+    CostModel::cost_shift(piece.m_cost, pendingShift);
   }
+  if(pendingDecay != 1)
+  {
+    inter = piece.m_interval;
+    ///MOVE bounds
+    piece.m_interval.seta(CostModel::cost_interExpDecay(inter.geta(), pendingDecay));
+    piece.m_interval.setb(CostModel::cost_interExpDecay(inter.getb(), pendingDecay));
+    ///MOVE Cost
+    CostModel::cost_expDecay(piece.m_cost, pendingDecay);
+  }
+  if(hasPendingCost == true){piece.addCostAndPenalty(pendingCost, pendingPenalty);}
+}
+
+template<typename CostModel>
+void ListPiece<CostModel>::clearPending()
+{
+  hasPending = false;
+  pendingShift = 0;
+  pendingDecay = 1;
+  hasPendingCost = false;
+  nbMaterialized = 0;
+  lastMaterialized = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////
 
+//##### size #####//////##### size #####//////##### size #####///
+//##### size #####//////##### size #####//////##### size #####///
+
+template<typename CostModel>
+std::size_t ListPiece<CostModel>::size() const {return(pieces.size());}
+
 //##### LP_edges_constraint #####//////##### LP_edges_constraint #####//////##### LP_edges_constraint #####///
 //##### LP_edges_constraint #####//////##### LP_edges_constraint #####//////##### LP_edges_constraint #####///
 
-void ListPiece::LP_edges_constraint(ListPiece const& LP_state, Edge const& edge, unsigned int newLabel)
+template<typename CostModel>
+void ListPiece<CostModel>::LP_edges_constraint(ListPiece<CostModel> const& LP_state, EdgeKind edge_kind, unsigned int parentState, unsigned int newLabel)
 {
   reset(); /// build a new LP_edges from scratch
 
   /// only 4 types of edges : null, std, up, down
-  /// EDGE PARAMETERS
-  std::string edge_ctt = edge.getConstraint();
-  double edge_parameter = edge.getParameter(); /// always positive
-  unsigned int parentState = edge.getState1(); ///parentState = state to associate
+  /// parentState = state to associate. The edge parameter is applied after by LP_edges_parameter
 
   //################
-  if(edge_ctt == "null") /// Simple copy of LP_state
+  if(edge_kind == EDGE_NULL) /// Simple copy of LP_state
   {
     copy(LP_state);
-    if(edge_parameter < 1){expDecay(edge_parameter);} ///edge_parameter = exponential decay
   }
 
   //################
-  if(edge_ctt == "std")
+  if(edge_kind == EDGE_STD) /// constant Piece at the minimum of LP_state (computed once by updateMinimum)
   {
-    ///variable definition
-    Piece* tmp = LP_state.head;
-    double globalMin = INFINITY;
-    unsigned int positionMin;
-    unsigned int currentCounter = 0;
-    double currentMin;
-
-
-    ///find the minimum
-    while(tmp != NULL)
-    {
-      currentCounter = currentCounter + 1;
-      currentMin = cost_minInterval(tmp -> m_cost, tmp -> m_interval);
-      if(currentMin < globalMin){globalMin = currentMin; positionMin = currentCounter;}
-      tmp = tmp -> nxt;
-    }
-
     ///add onePiece to LP_edges
-    Piece* onePiece = new Piece();
-    onePiece -> m_info = Track(newLabel, parentState, positionMin);
-    onePiece -> m_interval = Interval(LP_state.head -> m_interval.geta(), LP_state.lastPiece -> m_interval.getb());
-    onePiece -> addCostAndPenalty(Cost(), globalMin); /// Cost() = 0
+    Piece<CostModel> onePiece = Piece<CostModel>();
+    onePiece.m_info = Track(newLabel, parentState, LP_state.positionMin);
+    onePiece.m_interval = Interval(LP_state.pieces.front().m_interval.geta(), LP_state.pieces.back().m_interval.getb());
+    onePiece.addCostAndPenalty(Cost(), LP_state.globalMin); /// Cost() = 0
     addFirstPiece(onePiece);
   }
 
 
   //################
-  if(edge_ctt == "up")
+  if(edge_kind == EDGE_UP)
   {
-    operatorUp(LP_state, newLabel, parentState);
-    if(edge_parameter > 0){shift(edge_parameter);} ///edge_parameter = right decay
+    operatorUp(LP_state.pieces, newLabel, parentState);
   }
 
   //################
-  if(edge_ctt == "down")
+  if(edge_kind == EDGE_DOWN)
   {
-    ListPiece LP_stateCopy = ListPiece(); ///LP_state working copy
-    LP_stateCopy.copy(LP_state);
-    unsigned int length = 0;
-    LP_stateCopy.reverseAndCount(length); ///reverse LP_stateCopy
+    operatorDw(LP_state.pieces, newLabel, parentState); ///down operations (LP_state read from right to left)
+  }
 
-    operatorDw(LP_stateCopy, newLabel, parentState); ///down operations
-    reverseAndSetTrackPosition(length); ///reverse result
+}
 
-    if(edge_parameter > 0){shift(-edge_parameter);} ///edge_parameter = left decay
-  }
+//##### LP_edges_parameter #####//////##### LP_edges_parameter #####//////##### LP_edges_parameter #####///
+//##### LP_edges_parameter #####//////##### LP_edges_parameter #####//////##### LP_edges_parameter #####///
+/// edge_parameter always positive. Separated from LP_edges_constraint: the up (down) edges leaving the same state
+/// share the result of one operator and only differ by their gap
 
+template<typename CostModel>
+void ListPiece<CostModel>::LP_edges_parameter(EdgeKind edge_kind, double edge_parameter)
+{
+  if(edge_kind == EDGE_NULL && edge_parameter < 1){expDecay(edge_parameter);} ///edge_parameter = exponential decay
+  if(edge_kind == EDGE_UP && edge_parameter > 0){shift(edge_parameter);} ///edge_parameter = right decay
+  if(edge_kind == EDGE_DOWN && edge_parameter > 0){shift(-edge_parameter);} ///edge_parameter = left decay
 }
 
 //##### LP_edges_addPointAndPenalty #####//////##### LP_edges_addPointAndPenalty #####//////##### LP_edges_addPointAndPenalty #####///
 //##### LP_edges_addPointAndPenalty #####//////##### LP_edges_addPointAndPenalty #####//////##### LP_edges_addPointAndPenalty #####///
 
-void ListPiece::LP_edges_addPointAndPenalty(Edge const& edge, Point const& pt)
+template<typename CostModel>
+void ListPiece<CostModel>::LP_edges_addPointAndPenalty(double K, double a, double edge_beta, Cost const& costPt)
 {
-  Piece* current;
-  /// get edge data ///
-  double K = edge.getKK();
-  double a = edge.getAA();
-  double edge_beta = edge.getBeta();
-  /// get pt cost ///
-  double* coeff = cost_coeff(pt);
-  Cost costPt = Cost(coeff);
-
-  initializeCurrentPiece();
+  /// costPt = cost of the data point (Omega::dataCosts)
 
   ///////////////////// CASE K == INF /////////////////////
+  /// same addition on all the Pieces: deferred, each Piece gets it when LP_ts_Minimization reaches it (no extra pass)
   if(K == INFINITY)
   {
-    while(currentPiece != NULL)
-    {
-      currentPiece -> addCostAndPenalty(costPt, edge_beta);
-      currentPiece = currentPiece -> nxt;
-    }
+    pendingCost = costPt;
+    pendingPenalty = edge_beta;
+    hasPendingCost = true;
+    hasPending = true;
   }
 
   ///////////////////// CASE K != INF /////////////////////
   if(K != INFINITY)
   {
+    materialize(pieces.size() - 1); ///pending shift or decay
+    clearPending();
+
     ///Interval
-    Interval new_interval = cost_intervalInterRoots(costPt, K);
+    Interval new_interval = CostModel::cost_intervalInterRoots(costPt, K);
     double AK = new_interval.geta();
     double BK = new_interval.getb();
 
     /// INTIALIZATION for Robust cost left and right
+    double coeff[3];
     coeff[0] = 0;
     coeff[1] = -a;
     coeff[2] = K + a * AK;
@@ -348,72 +304,89 @@ void ListPiece::LP_edges_addPointAndPenalty(Edge const& edge, Point const& pt)
     double tmpA;
     double tmpB;
     int cas = 0;
+    Piece<CostModel> currentPiece;
+    bool remaining; ///a right part of currentPiece has still to be processed
 
-    while(currentPiece != NULL)
+    buffer.clear(); /// the new pieces (one Piece can be cut in two) are written in buffer
+    for(std::size_t i = 0; i < pieces.size(); i++)
     {
-      tmpA = currentPiece -> m_interval.geta();
-      tmpB = currentPiece -> m_interval.getb();
+      currentPiece = pieces[i];
+      remaining = true;
+      while(remaining == true)
+      {
+        remaining = false;
+        tmpA = currentPiece.m_interval.geta();
+        tmpB = currentPiece.m_interval.getb();
 
-      if(tmpB <= AK){cas = 0;}
-      if(BK <= tmpA){cas = 1;}
-      if(AK <= tmpA && tmpB <= BK){cas = 2;}
-      if(tmpA < BK && BK < tmpB){cas = 3;}
-      if(tmpA < AK && AK < tmpB){cas = 4;} // priority to AK over BK between tmpA and tmpB.
+        if(tmpB <= AK){cas = 0;}
+        if(BK <= tmpA){cas = 1;}
+        if(AK <= tmpA && tmpB <= BK){cas = 2;}
+        if(tmpA < BK && BK < tmpB){cas = 3;}
+        if(tmpA < AK && AK < tmpB){cas = 4;} // priority to AK over BK between tmpA and tmpB.
 
-      switch(cas)
-      {
-        case 0 : currentPiece -> addCostAndPenalty(slopeLeftCost, edge_beta);
-          break;
-        case 1 : currentPiece -> addCostAndPenalty(slopeRightCost, edge_beta);
-          break;
-        case 2 : currentPiece -> addCostAndPenalty(costPt, edge_beta);
-          break;
-        case 3 :
+        switch(cas)
         {
-          // A) create nextPiece3 as a copy and update bound left
-          Piece* nextPiece3 = new Piece(currentPiece);
-          nextPiece3 -> m_interval.seta(BK); // changing interval bounds
-          addCurrentPiecePlus1NotMove(nextPiece3);
-          // B) update currentPiece cost and bound right
-          currentPiece -> addCostAndPenalty(costPt, edge_beta); // adding costPt on the left
-          currentPiece -> m_interval.setb(BK); // changing interval bounds
-          break;
-        }
-        case 4 :
-        {
-          // A) create nextPiece4 as a copy and update bound left
-          Piece* nextPiece4 = new Piece(currentPiece);
-          nextPiece4 -> m_interval.seta(AK); // changing interval bounds
-          addCurrentPiecePlus1NotMove(nextPiece4);
-          // B) update currentPiece cost and bound right
-          currentPiece -> addCostAndPenalty(slopeLeftCost, edge_beta); // adding slopeLeftCost on the left
-          currentPiece -> m_interval.setb(AK); // changing interval bounds
-          break;
+          case 0 : currentPiece.addCostAndPenalty(slopeLeftCost, edge_beta);
+            break;
+          case 1 : currentPiece.addCostAndPenalty(slopeRightCost, edge_beta);
+            break;
+          case 2 : currentPiece.addCostAndPenalty(costPt, edge_beta);
+            break;
+          case 3 :
+          {
+            // A) create nextPiece3 as a copy and update bound left
+            Piece<CostModel> nextPiece3 = currentPiece;
+            nextPiece3.m_interval.seta(BK); // changing interval bounds
+            // B) update currentPiece cost and bound right
+            currentPiece.addCostAndPenalty(costPt, edge_beta); // adding costPt on the left
+            currentPiece.m_interval.setb(BK); // changing interval bounds
+            buffer.push_back(currentPiece);
+            currentPiece = nextPiece3; // processed at the next loop
+            remaining = true;
+            break;
+          }
+          case 4 :
+          {
+            // A) create nextPiece4 as a copy and update bound left
+            Piece<CostModel> nextPiece4 = currentPiece;
+            nextPiece4.m_interval.seta(AK); // changing interval bounds
+            // B) update currentPiece cost and bound right
+            currentPiece.addCostAndPenalty(slopeLeftCost, edge_beta); // adding slopeLeftCost on the left
+            currentPiece.m_interval.setb(AK); // changing interval bounds
+            buffer.push_back(currentPiece);
+            currentPiece = nextPiece4; // processed at the next loop
+            remaining = true;
+            break;
+          }
         }
       }
-      lastPiece = currentPiece; // DANGER: update lastPiece position
-      move();
+      buffer.push_back(currentPiece);
     }
+    pieces.swap(buffer);
   }
-  delete(coeff);
 }
 
 
 
 //##### LP_ts_Minimization #####//////##### LP_ts_Minimization #####//////##### LP_ts_Minimization #####///
 //##### LP_ts_Minimization #####//////##### LP_ts_Minimization #####//////##### LP_ts_Minimization #####///
+/// the result is built in LP_edge.buffer (free at this point) and then copied in this
+/// Q12 is kept as built, zero-width Pieces included: the backtracking searches the argmin in the interval of the Piece at the stored position
 
-void ListPiece::LP_ts_Minimization(ListPiece& LP_edge)
+template<typename CostModel>
+void ListPiece<CostModel>::LP_ts_Minimization(ListPiece<CostModel>& LP_edge, Context const& context)
 {
   // Initialize LP_edge -> same range as this
-  Interval newBounds = Interval(this -> head -> m_interval.geta(), this -> lastPiece -> m_interval.getb());
+  Interval newBounds = Interval(pieces.front().m_interval.geta(), pieces.back().m_interval.getb());
   LP_edge.setNewBounds(newBounds);
 
   //"MOST OF THE TIME" : Q2 > Q1
-  Piece* Q1 = head;  /// first Piece to compare
-  Piece* Q2 = LP_edge.head;  /// first Piece to compare
-  Piece* Q12 = new Piece();
-  Q12 -> m_interval = Interval(Q1 -> m_interval.geta(), Q1 -> m_interval.geta());
+  std::size_t Q1 = 0;  /// first Piece to compare in pieces
+  std::size_t Q2 = 0;  /// first Piece to compare in LP_edge.pieces
+  std::vector< Piece<CostModel> >& Q12 = LP_edge.buffer;
+  Q12.clear();
+  Q12.push_back(Piece<CostModel>());
+  Q12.back().m_interval = Interval(pieces[Q1].m_interval.geta(), pieces[Q1].m_interval.geta());
   int Bound_Q2_Minus_Q1 = 0;
   ///Q12 = Piece with an interval but no cost no label
   /// Bound_Q2_Minus_Q1
@@ -422,30 +395,45 @@ void ListPiece::LP_ts_Minimization(ListPiece& LP_edge)
   /// = -1 if bound interval Q2 - bound interval Q1 < 0 : Q1 stops
 
   ///start info
-  Piece* newHead = Q12;
-  double M = lastPiece -> m_interval.getb(); //global right bound
+  double M = pieces.back().m_interval.getb(); //global right bound
 
-  while(Q1 != NULL)
+  while(Q1 < pieces.size())
   {
     Bound_Q2_Minus_Q1 = -1;
     while(Bound_Q2_Minus_Q1 == -1)
     {
+      LP_edge.materialize(Q2);
       /// right bound
-      if(Q1 -> m_interval.getb() < Q2 -> m_interval.getb()){Bound_Q2_Minus_Q1 = 1;}
-      if(Q1 -> m_interval.getb() == Q2 -> m_interval.getb()){Bound_Q2_Minus_Q1 = 0;}
-      Q12 = Q12 -> pieceGenerator(Q1, Q2, Bound_Q2_Minus_Q1, M); ///add new Piece(s) to Q12
-      if(Bound_Q2_Minus_Q1 < 1){Q2 = Q2 -> nxt;}
+      if(pieces[Q1].m_interval.getb() < LP_edge.pieces[Q2].m_interval.getb()){Bound_Q2_Minus_Q1 = 1;}
+      if(pieces[Q1].m_interval.getb() == LP_edge.pieces[Q2].m_interval.getb()){Bound_Q2_Minus_Q1 = 0;}
+      pieceGenerator(Q12, pieces[Q1], LP_edge.pieces[Q2], Bound_Q2_Minus_Q1, M, context.m_epsilon); ///add new Piece(s) to Q12
+      if(Bound_Q2_Minus_Q1 < 1){Q2 = Q2 + 1;}
     }
-    Q1 = Q1 -> nxt;
+    Q1 = Q1 + 1;
   }
+  LP_edge.clearPending(); ///all the Pieces of LP_edge have been reached
 
-  reset(); ///UPDATE ListPiece LP_ts[t + 1][i]
-  head = newHead;
-  currentPiece = newHead;
-  lastPiece = Q12;
+  pieces.assign(Q12.begin(), Q12.end()); ///UPDATE ListPiece LP_ts[t + 1][i]
 }
 
 
+//##### updateMinimum #####//////##### updateMinimum #####//////##### updateMinimum #####///
+//##### updateMinimum #####//////##### updateMinimum #####//////##### updateMinimum #####///
+// globalMin and positionMin of the final LP_ts[t][s] : one scan per time step for the states with a std edge leaving (hasStdOut), shared by all these edges
+
+template<typename CostModel>
+void ListPiece<CostModel>::updateMinimum()
+{
+  double currentMin;
+  globalMin = INFINITY;
+  positionMin = 1;
+  for(std::size_t i = 0; i < pieces.size(); i++)
+  {
+    currentMin = CostModel::cost_minInterval(pieces[i].m_cost, pieces[i].m_interval);
+    if(currentMin < globalMin){globalMin = currentMin; positionMin = i + 1;}
+  }
+}
+
 
 //////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////
@@ -456,10 +444,10 @@ void ListPiece::LP_ts_Minimization(ListPiece& LP_edge)
 //##### operatorUp #####//////##### operatorUp #####//////##### operatorUp #####///
 //##### operatorUp #####//////##### operatorUp #####//////##### operatorUp #####///
 
-void ListPiece::operatorUp(ListPiece const& LP_state, unsigned int newLabel, unsigned int parentState)
+template<typename CostModel>
+void ListPiece<CostModel>::operatorUp(std::vector< Piece<CostModel> > const& LP_state, unsigned int newLabel, unsigned int parentState)
 {
   /// variable definition
-  Piece* tmp; ///to follow LP_state List
   double currentValue; ///for the ListPiece to build, last current value
   double rightBound; ///value at the (right) bound of the last build interval. Up case
   bool constPiece; ///has the Piece to build constant cost?
@@ -470,49 +458,49 @@ void ListPiece::operatorUp(ListPiece const& LP_state, unsigned int newLabel, uns
   //////////////////
   ///First Piece head
   //////////////////
-  head = new Piece();
-  tmp = LP_state.head;
+  pieces.clear();
+  pieces.push_back(Piece<CostModel>());
+  Piece<CostModel>& head = pieces.front();
+  Piece<CostModel> const& first = LP_state.front();
 
   /// INFO
-  head -> m_info.setTrack(trackUp); ///set Track
+  head.m_info.setTrack(trackUp); ///set Track
 
   /// INTERVAL
-  rightBound = tmp -> m_interval.geta(); ///tmp interval
-  head -> m_interval.seta(rightBound);
-  head -> m_interval.setb(rightBound);
+  rightBound = first.m_interval.geta(); ///tmp interval
+  head.m_interval.seta(rightBound);
+  head.m_interval.setb(rightBound);
 
   /// COST
-  currentValue = cost_eval(tmp -> m_cost, rightBound); ///tmp cost value
-  addConstant(head -> m_cost, currentValue);
+  currentValue = CostModel::cost_eval(first.m_cost, rightBound); ///tmp cost value
+  addConstant(head.m_cost, currentValue);
 
   /// bool constPiece : is the first Piece constant? If cost increasing at bound, constPiece = true
 
-  if(cost_argmin(tmp -> m_cost) <= rightBound && isConstant(tmp -> m_cost) == false){constPiece = true;}else{constPiece = false;}
+  if(CostModel::cost_argmin(first.m_cost) <= rightBound && isConstant(first.m_cost) == false){constPiece = true;}else{constPiece = false;}
 
-  initializeCurrentPiece(); ///currentPiece = head
   ///////////////////////////
 
-  while(tmp != NULL)
+  for(std::size_t i = 0; i < LP_state.size(); i++)
   {
+    Piece<CostModel> const& tmp = LP_state[i];
     ///decreasingInterval for currentPiece to create based on current tmp
-    decreasingInterval = tmp -> intervalMinLessUp(rightBound, currentValue, constPiece); ///"decreasing" interval
-    decreasingInterval = decreasingInterval.intersection(tmp -> m_interval); ///decreasingInterval = intersection of decreasingInterval (=intervalMinLess) and interval of  tmp
+    decreasingInterval = tmp.intervalMinLessUp(rightBound, currentValue, constPiece); ///"decreasing" interval
+    decreasingInterval = decreasingInterval.intersection(tmp.m_interval); ///decreasingInterval = intersection of decreasingInterval (=intervalMinLess) and interval of  tmp
     if(decreasingInterval.isEmpty() == false){trackUp.setPosition(counter);}
 
     /// paste new piece(s)
-    currentPiece = currentPiece -> pastePieceUp(tmp, decreasingInterval, trackUp); ///add new Piece to BUILD
+    pastePieceUp(pieces, tmp, i + 1 == LP_state.size(), decreasingInterval, trackUp); ///add new Piece to BUILD
     ///
 
     ///UDPATES rightBound, currentValue, constPiece
-    rightBound = currentPiece -> m_interval.getb(); ///new rightBound
-    currentValue = cost_eval(currentPiece -> m_cost, rightBound); ///new currentValue (=the minimum)
+    rightBound = pieces.back().m_interval.getb(); ///new rightBound
+    currentValue = CostModel::cost_eval(pieces.back().m_cost, rightBound); ///new currentValue (=the minimum)
     if(constPiece == true){if(decreasingInterval.isEmpty() == false){constPiece = false;}}
-    if(constPiece == false){if(decreasingInterval.getb() < tmp -> m_interval.getb()){constPiece = true;}}
+    if(constPiece == false){if(decreasingInterval.getb() < tmp.m_interval.getb()){constPiece = true;}}
 
-    tmp = tmp -> nxt;
     counter = counter + 1;
   }
-  lastPiece = currentPiece;
 }
 
 
@@ -520,66 +508,343 @@ void ListPiece::operatorUp(ListPiece const& LP_state, unsigned int newLabel, uns
 //##### operatorDw #####//////##### operatorDw #####//////##### operatorDw #####///
 //##### operatorDw #####//////##### operatorDw #####//////##### operatorDw #####///
 
-void ListPiece::operatorDw(ListPiece const& LP_state, unsigned int newLabel, unsigned int parentState)
+template<typename CostModel>
+void ListPiece<CostModel>::operatorDw(std::vector< Piece<CostModel> > const& LP_state, unsigned int newLabel, unsigned int parentState)
 {
   /// variable definition
-  Piece* tmp; ///to follow LP_state List
   double currentValue; ///for the ListPiece to build, last current value
   double leftBound; ///value at the (left) bound of the last build interval. Down case
   bool constPiece; ///has the Piece to build constant cost?
-  unsigned int counter = 1; ///number of the considered Piece in LP_edge
-  Track trackUp = Track(newLabel, parentState, counter);
+  Track trackUp = Track(newLabel, parentState, LP_state.size()); ///position of the considered Piece in LP_state (from 1)
   Interval decreasingInterval = Interval(); /// for interval building
 
 
   //////////////////
   ///First Piece head
   //////////////////
-  head = new Piece();
-  tmp = LP_state.head;
+  pieces.clear();
+  pieces.push_back(Piece<CostModel>());
+  Piece<CostModel>& head = pieces.front();
+  Piece<CostModel> const& first = LP_state.back(); ///the Pieces are built from right to left
 
   /// INFO
-  head -> m_info.setTrack(trackUp); ///set Track
+  head.m_info.setTrack(trackUp); ///set Track
 
   /// INTERVAL
-  leftBound = tmp -> m_interval.getb();
-  head -> m_interval.seta(leftBound);
-  head -> m_interval.setb(leftBound);
+  leftBound = first.m_interval.getb();
+  head.m_interval.seta(leftBound);
+  head.m_interval.setb(leftBound);
 
   /// COST
-  currentValue = cost_eval(tmp -> m_cost, leftBound);
-  addConstant(head -> m_cost, currentValue);
+  currentValue = CostModel::cost_eval(first.m_cost, leftBound);
+  addConstant(head.m_cost, currentValue);
 
   /// bool constPiece : is the first Piece constant? If cost increasing at bound, constPiece = true
-  if(cost_argmin(tmp -> m_cost) >= leftBound && isConstant(tmp -> m_cost) == false){constPiece = true;}else{constPiece = false;}
-
-  initializeCurrentPiece(); ///currentPiece = head
+  if(CostModel::cost_argmin(first.m_cost) >= leftBound && isConstant(first.m_cost) == false){constPiece = true;}else{constPiece = false;}
 
   ///////////////////////////
 
-  while(tmp != NULL)
+  for(std::size_t i = LP_state.size(); i-- > 0;)
   {
+    Piece<CostModel> const& tmp = LP_state[i];
     ///decreasingInterval for currentPiece to create based on current tmp
-    decreasingInterval = tmp -> intervalMinLessDw(leftBound, currentValue, constPiece); ///"decreasing" interval
-    //std::cout << leftBound << " " << currentValue << " " << constPiece << std::endl;
-    //decreasingInterval.show();
-    decreasingInterval = decreasingInterval.intersection(tmp -> m_interval); ///decreasingInterval = intersection of decreasingInterval (=intervalMinLess) and interval of  tmp
-    if(decreasingInterval.isEmpty() == false){trackUp.setPosition(counter);}
+    decreasingInterval = tmp.intervalMinLessDw(leftBound, currentValue, constPiece); ///"decreasing" interval
+    decreasingInterval = decreasingInterval.intersection(tmp.m_interval); ///decreasingInterval = intersection of decreasingInterval (=intervalMinLess) and interval of  tmp
+    if(decreasingInterval.isEmpty() == false){trackUp.setPosition(i + 1);}
 
     /// paste new piece(s)
-    currentPiece = currentPiece ->pastePieceDw(tmp, decreasingInterval, trackUp); ///add new Piece to BUILD
+    pastePieceDw(pieces, tmp, i == 0, decreasingInterval, trackUp); ///add new Piece to BUILD
     ///
 
     ///UDPATES rightBound, currentValue, constPiece
-    leftBound = currentPiece -> m_interval.geta(); ///new rightBound
-    currentValue = cost_eval(currentPiece -> m_cost, leftBound); ///new currentValue (=the minimum)
+    leftBound = pieces.back().m_interval.geta(); ///new rightBound
+    currentValue = CostModel::cost_eval(pieces.back().m_cost, leftBound); ///new currentValue (=the minimum)
     if(constPiece == true){if(decreasingInterval.isEmpty() == false){constPiece = false;}}
-    if(constPiece == false){if(decreasingInterval.geta() > tmp -> m_interval.geta()){constPiece = true;}}
+    if(constPiece == false){if(decreasingInterval.geta() > tmp.m_interval.geta()){constPiece = true;}}
+  }
 
-    tmp = tmp -> nxt;
-    counter = counter + 1;
+  std::reverse(pieces.begin(), pieces.end()); ///increasing intervals
+}
+
+
+//####### pastePieceUp #######// //####### pastePieceUp #######// //####### pastePieceUp #######//
+//####### pastePieceUp #######// //####### pastePieceUp #######// //####### pastePieceUp #######//
+/// BUILD = out.back(). lastNXTPiece = NXTPiece is the last Piece of its list
+
+template<typename CostModel>
+void ListPiece<CostModel>::pastePieceUp(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& NXTPiece, bool lastNXTPiece, Interval const& decrInter, Track const& newTrack)
+{
+  Piece<CostModel>& BUILD = out.back();
+
+  /// decreasingInterval = (a,b)
+  /// Q -> m_interval = (m_a,m_b)
+
+  if(decrInter.isEmpty())
+  {
+    BUILD.m_interval.setb(NXTPiece.m_interval.getb());
+  }
+  else
+  {
+    BUILD.m_interval.setb(decrInter.geta());    ///if a > m_a, no change otherwise
+
+    ///ADD of the PIECE NXTPiece (troncated)
+    if(BUILD.m_interval.isEmpty()) ///if BUILD empty
+    {
+      BUILD.m_interval.setb(decrInter.getb());
+      BUILD.m_cost = NXTPiece.m_cost;
+      BUILD.m_info.setTrack(newTrack);
+    }
+    else
+    {
+      out.push_back(Piece<CostModel>(newTrack, decrInter, NXTPiece.m_cost));
+    }
+
+    if(!(lastNXTPiece && (decrInter.getb() == NXTPiece.m_interval.getb())))
+    {
+      double outputValue = CostModel::cost_eval(NXTPiece.m_cost, decrInter.getb());
+      Piece<CostModel> PieceOut = Piece<CostModel>(newTrack, Interval(decrInter.getb(), NXTPiece.m_interval.getb()), Cost());
+      addConstant(PieceOut.m_cost, outputValue);
+      out.push_back(PieceOut);
+    }
+  }
+}
+
+
+
+//####### pastePieceDw #######// //####### pastePieceDw #######// //####### pastePieceDw #######//
+//####### pastePieceDw #######// //####### pastePieceDw #######// //####### pastePieceDw #######//
+/// BUILD = out.back(). lastNXTPiece = NXTPiece is the last Piece of its list
+
+template<typename CostModel>
+void ListPiece<CostModel>::pastePieceDw(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& NXTPiece, bool lastNXTPiece, Interval const& decrInter, Track const& newTrack)
+{
+  Piece<CostModel>& BUILD = out.back();
+
+  /// decreasingInterval = (a,b)
+  /// NXTPiece -> m_interval = (m_a,m_b)
+
+  if(decrInter.isEmpty())
+  {
+    BUILD.m_interval.seta(NXTPiece.m_interval.geta());
+  }
+  else
+  {
+    BUILD.m_interval.seta(decrInter.getb());    ///if a > m_a, no change otherwise
+
+    ///ADD of the PIECE NXTPiece (troncated)
+    if(BUILD.m_interval.isEmpty()) ///if BUILD empty
+    {
+      BUILD.m_interval.seta(decrInter.geta());
+      BUILD.m_cost = NXTPiece.m_cost;
+      BUILD.m_info.setTrack(newTrack);
+    }
+    else
+    {
+      out.push_back(Piece<CostModel>(newTrack, decrInter, NXTPiece.m_cost));
+    }
+
+    if(!(lastNXTPiece && (decrInter.geta() == NXTPiece.m_interval.geta())))
+    {
+      double outputValue = CostModel::cost_eval(NXTPiece.m_cost, decrInter.geta());
+      Piece<CostModel> PieceOut = Piece<CostModel>(newTrack, Interval(NXTPiece.m_interval.geta(), decrInter.geta()), Cost());
+      addConstant(PieceOut.m_cost, outputValue);
+      out.push_back(PieceOut);
+    }
   }
-  lastPiece = currentPiece;
+}
+
+
+//####### pieceGenerator #######// //####### pieceGenerator #######// //####### pieceGenerator #######//
+//####### pieceGenerator #######// //####### pieceGenerator #######// //####### pieceGenerator #######//
+
+template<typename CostModel>
+void ListPiece<CostModel>::pieceGenerator(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& Q1, Piece<CostModel> const& Q2, int Bound_Q2_Minus_Q1, double M, double epsilon)
+{
+  double zero = 0;
+
+  // INFORMATION interToPaste
+  // Interval interToPaste = interval on which we build BUILD = right BUILD TO min(right Q1, right Q2)
+  Interval interToPaste = Interval();
+  interToPaste.seta(out.back().m_interval.getb()); ///enter Piece BUILD
+  if(Bound_Q2_Minus_Q1 == -1)
+         {interToPaste.setb(Q2.m_interval.getb());
+    }else{interToPaste.setb(Q1.m_interval.getb());}
+
+  // INFORMATION interRoots
+  // Interval interRoots (Q1 - Q2)
+  Cost costDiff = minusCost(Q1.m_cost, Q2.m_cost);
+  Interval interRoots = CostModel::cost_intervalInterRoots(costDiff, zero);
+
+  //// INFORMATION change
+  // int change = 0, 1 or 2 change-points
+  // if bounds of interRoots close to bounds of interToPaste > epsilon
+  unsigned int change = 0;
+  if((interRoots.geta() > interToPaste.geta() + epsilon)&&(interRoots.geta() + epsilon < interToPaste.getb())){change = change + 1;}
+  if((interRoots.getb() > interToPaste.geta() + epsilon)&&(interRoots.getb() + epsilon < interToPaste.getb())){change = change + 1;}
+
+
+
+  ///Security steps: length interRoots very small < epsilon
+  if(interRoots.getb() - interRoots.geta() < epsilon)
+  {
+    change = 0;
+    interRoots.seta(interToPaste.geta());
+    interRoots.setb(interToPaste.getb());
+  }
+
+  // CONSTRUCTION
+  int Q2_Minus_Q1;  ///Sign of Q2 - Q1
+
+  switch(change)
+  {
+    case 0 : /// IF WE ADD 0 PIECE
+    {
+      piece0(out, Q1, Q2, interToPaste, Q2_Minus_Q1);
+      break;
+    }
+    case 1 : /// IF WE ADD 1 PIECE
+    {
+      piece1(out, Q1, Q2, interToPaste, interRoots, Q2_Minus_Q1);
+      break;
+    }
+    case 2 : /// IF WE ADD 2 PIECES
+    {
+      piece2(out, Q1, Q2, interToPaste, interRoots, Q2_Minus_Q1);
+      break;
+    }
+  }
+
+  //CONSTRUCTION outPiece
+  ///Need of a last "OUT" Piece if we have reached the end of the Piece Q1 or Piece Q2
+  if((((Q2_Minus_Q1 == 1) && (Bound_Q2_Minus_Q1 >= 0)) || ((Q2_Minus_Q1 == -1) && (Bound_Q2_Minus_Q1 <= 0)))
+       && (interToPaste.getb() != M))
+  {
+    Piece<CostModel> outPiece = Piece<CostModel>();
+    outPiece.m_interval = Interval(interToPaste.getb(), interToPaste.getb());
+    out.push_back(outPiece);
+  }
+}
+
+
+//####### piece0 #######// //####### piece0 #######// //####### piece0 #######//
+//####### piece0 #######// //####### piece0 #######// //####### piece0 #######//
+
+template<typename CostModel>
+void ListPiece<CostModel>::piece0(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& Q1, Piece<CostModel> const& Q2, Interval interToPaste, int& Q2_Minus_Q1)
+{
+  Piece<CostModel>& BUILD = out.back();
+
+  /// Possible inversion => test Q2_Minus_Q1 at centerPoint
+  double centerPoint = interToPaste.internPoint();
+  Cost costDiff = minusCost(Q2.m_cost, Q1.m_cost);
+  Q2_Minus_Q1 = signValue(CostModel::cost_eval(costDiff, centerPoint));
+  bool test;
+
+  if (BUILD.m_interval.isEmpty() == true) /// IF BUILD interval = empty
+  {
+    BUILD.m_interval.setb(interToPaste.getb());
+    if(Q2_Minus_Q1 == 1){BUILD.m_cost = Q1.m_cost; BUILD.m_info = Q1.m_info;}
+    if(Q2_Minus_Q1 == -1){BUILD.m_cost = Q2.m_cost; BUILD.m_info = Q2.m_info;}
+  }
+  else
+  {
+    ///SECURITY step
+    Cost testCost = BUILD.m_cost;
+    if(Q2_Minus_Q1 == 1){test = isEqual(testCost, Q1.m_cost);}
+    if(Q2_Minus_Q1 == -1){test = isEqual(testCost, Q2.m_cost);}
+
+    if (test == true) ///Prolongation
+    {
+      BUILD.m_interval.setb(interToPaste.getb());
+      if(Q2_Minus_Q1 == 1){BUILD.m_cost = Q1.m_cost; BUILD.m_info = Q1.m_info;}
+      if(Q2_Minus_Q1 == -1){BUILD.m_cost = Q2.m_cost; BUILD.m_info = Q2.m_info;}
+    }
+    else ///pb with the cost -> we stop BUILD interval at interToPaste left -> we create a new piece
+    {
+      //CONSTRUCTION newPiece
+      BUILD.m_interval.setb(interToPaste.geta());
+      Piece<CostModel> newPiece = Piece<CostModel>();
+      newPiece.m_interval = interToPaste;
+      if(Q2_Minus_Q1 == 1){newPiece.m_cost = Q1.m_cost; newPiece.m_info = Q1.m_info;}
+      if(Q2_Minus_Q1 == -1){newPiece.m_cost = Q2.m_cost; newPiece.m_info = Q2.m_info;}
+      out.push_back(newPiece);
+    }
+  }
+}
+
+//####### piece1 #######// //####### piece1 #######// //####### piece1 #######//
+//####### piece1 #######// //####### piece1 #######// //####### piece1 #######//
+
+template<typename CostModel>
+void ListPiece<CostModel>::piece1(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& Q1, Piece<CostModel> const& Q2, Interval interToPaste, Interval interRoots, int& Q2_Minus_Q1)
+{
+  Piece<CostModel>& BUILD = out.back();
+  //PROLONGATION theChangePoint
+  double theChangePoint;
+  if(interToPaste.geta() < interRoots.geta()){theChangePoint = interRoots.geta();}
+                                         else{theChangePoint = interRoots.getb();}
+
+  //// FIND the winner on the new piece
+  // centerPoint = centre (left interToPaste, right theChangePoint)
+  double centerPoint = Interval(interToPaste.geta(), theChangePoint).internPoint();
+  Cost costDiff = minusCost(Q2.m_cost, Q1.m_cost);
+  Q2_Minus_Q1 = signValue(CostModel::cost_eval(costDiff, centerPoint));
+
+  if(Q2_Minus_Q1 == 1){BUILD.m_cost = Q1.m_cost; BUILD.m_info = Q1.m_info;}
+  if(Q2_Minus_Q1 == -1){BUILD.m_cost = Q2.m_cost; BUILD.m_info = Q2.m_info;}
+
+  BUILD.m_interval.setb(theChangePoint);
+
+  //CONSTRUCTION newPiece
+  Piece<CostModel> newPiece = Piece<CostModel>();
+  newPiece.m_interval = Interval(theChangePoint, interToPaste.getb());
+
+  centerPoint = newPiece.m_interval.internPoint();
+  costDiff = minusCost(Q2.m_cost, Q1.m_cost);
+  Q2_Minus_Q1 = signValue(CostModel::cost_eval(costDiff, centerPoint));
+
+  if(Q2_Minus_Q1 == 1){newPiece.m_cost = Q1.m_cost; newPiece.m_info = Q1.m_info;}
+  if(Q2_Minus_Q1 == -1){newPiece.m_cost = Q2.m_cost; newPiece.m_info = Q2.m_info;}
+  out.push_back(newPiece);
+}
+
+
+
+
+//####### piece2 #######// //####### piece2 #######// //####### piece2 #######//
+//####### piece2 #######// //####### piece2 #######// //####### piece2 #######//
+
+template<typename CostModel>
+void ListPiece<CostModel>::piece2(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& Q1, Piece<CostModel> const& Q2, Interval interToPaste, Interval interRoots, int& Q2_Minus_Q1)
+{
+  Piece<CostModel>& BUILD = out.back();
+
+  //PROLONGATION theChangePoint
+  //FIND the winner on the newpiece1 (the central piece defined on interval interRoots)
+  double centerPoint = interRoots.internPoint();
+  Cost costDiff = minusCost(Q2.m_cost, Q1.m_cost);
+  Q2_Minus_Q1 = signValue(CostModel::cost_eval(costDiff, centerPoint));///INVERSION!!!
+
+  Q2_Minus_Q1 = -Q2_Minus_Q1; ///INVERSION!!!
+  if(Q2_Minus_Q1 == 1){BUILD.m_cost = Q1.m_cost; BUILD.m_info = Q1.m_info;}
+  if(Q2_Minus_Q1 == -1){BUILD.m_cost = Q2.m_cost; BUILD.m_info = Q2.m_info;}
+  BUILD.m_interval.setb(interRoots.geta());
+
+  //CONSTRUCTION newPiece1
+  Q2_Minus_Q1 = -Q2_Minus_Q1; ///INVERSION!!!
+  Piece<CostModel> newPiece1 = Piece<CostModel>();
+  newPiece1.m_interval = interRoots;
+  if(Q2_Minus_Q1 == 1){newPiece1.m_cost = Q1.m_cost; newPiece1.m_info = Q1.m_info;}
+  if(Q2_Minus_Q1 == -1){newPiece1.m_cost = Q2.m_cost; newPiece1.m_info = Q2.m_info;}
+  out.push_back(newPiece1);
+
+  Q2_Minus_Q1 = -Q2_Minus_Q1;  ///INVERSION!!!
+  //CONSTRUCTION newPiece2
+  Piece<CostModel> newPiece2 = Piece<CostModel>();
+  newPiece2.m_interval = Interval(interRoots.getb(), interToPaste.getb());
+  if(Q2_Minus_Q1 == 1){newPiece2.m_cost = Q1.m_cost; newPiece2.m_info = Q1.m_info;}
+  if(Q2_Minus_Q1 == -1){newPiece2.m_cost = Q2.m_cost; newPiece2.m_info = Q2.m_info;}
+  out.push_back(newPiece2);
 }
 
 
@@ -588,38 +853,60 @@ void ListPiece::operatorDw(ListPiece const& LP_state, unsigned int newLabel, uns
 //####### min_argmin_label_state_position_final #######// //####### min_argmin_label_state_position_final #######// //####### min_argmin_label_state_position_final #######//
 ///We test all the Piece
 
-void ListPiece::get_min_argmin_label_state_position_ListPiece(double* response)
+template<typename CostModel>
+void ListPiece<CostModel>::get_min_argmin_label_state_position_ListPiece(double* response) const
 {
-  Piece* tmp = head;
-
   ///INITIALIZATION
-  tmp -> get_min_argmin_label_state_position(response);
+  pieces[0].get_min_argmin_label_state_position(response);
   double current_min;
 
-  tmp = tmp -> nxt;
-
   ///LOOP TESTS
-  while(tmp != NULL)
+  for(std::size_t i = 1; i < pieces.size(); i++)
   {
-    current_min = cost_minInterval(tmp -> m_cost, tmp -> m_interval);
+    current_min = CostModel::cost_minInterval(pieces[i].m_cost, pieces[i].m_interval);
     if(current_min < response[0])
     {
-      tmp -> get_min_argmin_label_state_position(response);
+      pieces[i].get_min_argmin_label_state_position(response);
     }
-    tmp = tmp -> nxt;
   }
 }
 
 //####### get_min_argmin_label_state_position_onePiece #######// //####### get_min_argmin_label_state_position_onePiece #######// //####### get_min_argmin_label_state_position_onePiece #######//
 //####### get_min_argmin_label_state_position_onePiece #######// //####### get_min_argmin_label_state_position_onePiece #######// //####### get_min_argmin_label_state_position_onePiece #######//
-///We test all the Piece
+///direct access to the Piece number position (1 = first Piece)
 
-void ListPiece::get_min_argmin_label_state_position_onePiece(double* response, unsigned int position, Interval constrainedInterval, bool out, bool& forced)
+template<typename CostModel>
+void ListPiece<CostModel>::get_min_argmin_label_state_position_onePiece(double* response, unsigned int position, Interval constrainedInterval, bool out, bool& forced) const
+{
+  pieces[position - 1].get_min_argmin_label_state_position(response);
+
+  argminCorrection(response, constrainedInterval, out, forced);
+}
+
+//####### trace #######// //####### trace #######// //####### trace #######//
+//####### trace #######// //####### trace #######// //####### trace #######//
+///append the backtracking information of each Piece to trace
+
+template<typename CostModel>
+void ListPiece<CostModel>::trace(Trace& trace) const
+{
+  TracePiece tracePiece;
+  for(std::size_t i = 0; i < pieces.size(); i++)
+  {
+    tracePiece.m_info = pieces[i].m_info;
+    tracePiece.m_interval = pieces[i].m_interval;
+    tracePiece.m_A = pieces[i].m_cost.m_A;
+    tracePiece.m_B = pieces[i].m_cost.m_B;
+    trace.addPiece(tracePiece);
+  }
+}
+
+//####### argminCorrection #######// //####### argminCorrection #######// //####### argminCorrection #######//
+//####### argminCorrection #######// //####### argminCorrection #######// //####### argminCorrection #######//
+///move the argmin response[1] to fit the constraint with the next segment
+
+void argminCorrection(double* response, Interval const& constrainedInterval, bool out, bool& forced)
 {
-  Piece* tmp = head;
-  unsigned int nb = 1;
-  while(nb < position){tmp = tmp -> nxt; nb = nb + 1;}
-  tmp -> get_min_argmin_label_state_position(response);
   forced = false;
 
   /// argmin correction
@@ -648,10 +935,18 @@ void ListPiece::get_min_argmin_label_state_position_onePiece(double* response, u
 /////////////////////////////////////////
 /////////////////////////////////////////
 
-void ListPiece::show() const
+template<typename CostModel>
+void ListPiece<CostModel>::show() const
 {
-  std::cout << "    HEAD      " << head << std::endl;
-  std::cout << "    CURRENTPI " << currentPiece << std::endl;
-  std::cout << "    LASTPIECE " << lastPiece << std::endl;
-  head -> show();
+  std::cout << "    NB PIECES " << pieces.size() << std::endl;
+  for(std::size_t i = 0; i < pieces.size(); i++){pieces[i].show();}
 }
+
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+
+template class ListPiece<MeanCost>;
+template class ListPiece<VarianceCost>;
+template class ListPiece<PoissonCost>;
+template class ListPiece<ExpCost>;
+template class ListPiece<NegbinCost>;
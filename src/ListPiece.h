@@ -3,55 +3,85 @@
 
 #include "Piece.h"
 #include "Edge.h"
-#include "ExternFunctions.h"
+#include "CompiledGraph.h"
+#include "CostModel.h"
+#include "Trace.h"
+#include "Context.h"
 
 #include <math.h>
+#include <vector>
 
+template<typename CostModel>
 class ListPiece
 {
 private:
-  Piece* head;
-  Piece* currentPiece;
-  Piece* lastPiece;
+  std::vector< Piece<CostModel> > pieces; ///the Pieces ordered by increasing intervals, stored contiguously
+  std::vector< Piece<CostModel> > buffer; ///output of the operators before it replaces pieces (reused at each step, empty in LP_ts)
+  double globalMin; ///minimum of the cost over all the Pieces (set by updateMinimum, used by the std edges)
+  unsigned int positionMin; ///position (from 1) of the Piece reaching globalMin
+  bool hasPending; ///LP_edges: shift, decay or cost not yet applied to all the Pieces (done when a Piece is read, see materialize)
+  double pendingShift; ///gap of the up/down edge (0 = none)
+  double pendingDecay; ///decay of the null edge (1 = none)
+  bool hasPendingCost; ///K = INFINITY: pendingCost + pendingPenalty added to all the Pieces
+  Cost pendingCost;
+  double pendingPenalty;
+  std::size_t nbMaterialized; ///the Pieces 0..nbMaterialized-1 have their pending operations applied
+  bool lastMaterialized; ///idem for the last Piece
+
+  ///////  build by appending to out (the last Piece of out = BUILD) ///////
+  static void pastePieceUp(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& NXTPiece, bool lastNXTPiece, Interval const& decrInter, Track const& newTrack);
+  static void pastePieceDw(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& NXTPiece, bool lastNXTPiece, Interval const& decrInter, Track const& newTrack);
+
+  void materialize(std::size_t i);
+  void materializeLast();
+  void materializePiece(Piece<CostModel>& piece) const;
+  void clearPending();
+
+  static void pieceGenerator(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& Q1, Piece<CostModel> const& Q2, int Bound_Q2_Minus_Q1, double M, double epsilon);
+  static void piece0(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& Q1, Piece<CostModel> const& Q2, Interval interToPaste, int& Q2_Minus_Q1);
+  static void piece1(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& Q1, Piece<CostModel> const& Q2, Interval interToPaste, Interval interRoots, int& Q2_Minus_Q1);
+  static void piece2(std::vector< Piece<CostModel> >& out, Piece<CostModel> const& Q1, Piece<CostModel> const& Q2, Interval interToPaste, Interval interRoots, int& Q2_Minus_Q1);
 
 public:
   ListPiece();
-  ~ListPiece();
 
   ///////  Simple list operations  ///////
   void setUniquePieceCostToInfinity();
   void setNewBounds(Interval newBounds);
 
   void reset();
-  void copy(ListPiece  const& LP_edge);
+  void copy(ListPiece<CostModel>  const& LP_edge);
+  void take(ListPiece<CostModel>& LP_state);
 
-  void reverseAndCount(unsigned int& length);
-  void reverseAndSetTrackPosition(unsigned int length);
+  void countChangepoints(ListPiece<CostModel> const& LP_state);
 
-  void move();
-  void initializeCurrentPiece();
-
-  void addCurrentPiecePlus1NotMove(Piece* newPiece);
-  void addFirstPiece(Piece* newPiece);
+  void addFirstPiece(Piece<CostModel> const& newPiece);
 
   void shift(double parameter);
   void expDecay(double gamma);
 
   ///////  3 OPERATIONS in GFPOP ///////
-  void LP_edges_constraint(ListPiece const& LP_state, Edge const& edge, unsigned int newLabel);
-  void LP_edges_addPointAndPenalty(Edge const& edge, Point const& pt);
-  void LP_ts_Minimization(ListPiece& LP_edge);
+  void LP_edges_constraint(ListPiece<CostModel> const& LP_state, EdgeKind edge_kind, unsigned int parentState, unsigned int newLabel);
+  void LP_edges_parameter(EdgeKind edge_kind, double edge_parameter);
+  void LP_edges_addPointAndPenalty(double K, double a, double edge_beta, Cost const& costPt);
+  void LP_ts_Minimization(ListPiece<CostModel>& LP_edge, Context const& context);
+  void updateMinimum();
 
   ///////  operators up and down ///////
-  void operatorUp(ListPiece const& LP_edge, unsigned int newLabel, unsigned int parentState);
-  void operatorDw(ListPiece const& LP_edge, unsigned int newLabel, unsigned int parentState);
+  void operatorUp(std::vector< Piece<CostModel> > const& LP_state, unsigned int newLabel, unsigned int parentState);
+  void operatorDw(std::vector< Piece<CostModel> > const& LP_state, unsigned int newLabel, unsigned int parentState);
 
   ///////  get info ///////
-  void get_min_argmin_label_state_position_ListPiece(double* response);
-  void get_min_argmin_label_state_position_onePiece(double* response, unsigned int position, Interval constrainedInterval, bool out, bool& forced);
+  std::size_t size() const; ///number of Pieces
+  void get_min_argmin_label_state_position_ListPiece(double* response) const;
+  void get_min_argmin_label_state_position_onePiece(double* response, unsigned int position, Interval constrainedInterval, bool out, bool& forced) const;
+
+  void trace(Trace& trace) const;
 
   void show() const;
 
 };
 
+void argminCorrection(double* response, Interval const& constrainedInterval, bool out, bool& forced);
+
 #endif // LISTPIECE_H
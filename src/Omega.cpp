@@ -8,21 +8,33 @@
 //####### constructor #######////####### constructor #######////####### constructor #######//
 //####### constructor #######////####### constructor #######////####### constructor #######//
 
-Omega::Omega(Graph graph)
+template<typename CostModel>
+Omega<CostModel>::Omega(Graph graph, std::string storage, unsigned int checkpoint, std::string file, Context const& context)
 {
+  m_context = context;
   m_graph = graph;
+  m_edges = CompiledGraph(graph);
+  m_storage = storage;
+  m_checkpoint = checkpoint;
+  m_file = file;
+  m_costs = NULL;
 	p = graph.nb_states();
 	q = graph.nb_edges();
 
   /// INITIALIZE ListPiece ///
-  LP_edges = new ListPiece[q];
+  LP_edges = new ListPiece<CostModel>[q];
   LP_ts = NULL;
+
+  m_context.m_nbThreads = ThreadPool::usefulThreads(m_context.m_nbThreads, q);
+  m_pool = NULL;
+  if(m_context.m_nbThreads > 1){m_pool = new ThreadPool(m_context.m_nbThreads);}
 }
 
 //####### destructor #######////####### destructor #######////####### destructor #######//
 //####### destructor #######////####### destructor #######////####### destructor #######//
 
-Omega::~Omega()
+template<typename CostModel>
+Omega<CostModel>::~Omega()
 {
   if(LP_ts != NULL)
   {
@@ -32,56 +44,50 @@ Omega::~Omega()
   }
   delete [] LP_edges;
   LP_edges = NULL;
+  delete m_pool;
+  m_pool = NULL;
 }
 
 //####### accessors #######////####### accessors #######////####### accessors #######//
 //####### accessors #######////####### accessors #######////####### accessors #######//
 
-std::vector< int > Omega::GetChangepoints() const{return(changepoints);}
-std::vector< double > Omega::GetParameters() const{return(parameters);}
-std::vector< int > Omega::GetStates() const{return(states);}
-std::vector< int > Omega::GetForced() const{return(forced);}
-double Omega::GetGlobalCost() const{return(globalCost);}
+template<typename CostModel> std::vector< int > Omega<CostModel>::GetChangepoints() const{return(changepoints);}
+template<typename CostModel> std::vector< double > Omega<CostModel>::GetParameters() const{return(parameters);}
+template<typename CostModel> std::vector< int > Omega<CostModel>::GetStates() const{return(states);}
+template<typename CostModel> std::vector< int > Omega<CostModel>::GetForced() const{return(forced);}
+template<typename CostModel> double Omega<CostModel>::GetGlobalCost() const{return(globalCost);}
+template<typename CostModel> double Omega<CostModel>::GetPenalizedCost() const{return(penalizedCost);}
+template<typename CostModel> double Omega<CostModel>::GetPenalty() const{return(penalty);}
+template<typename CostModel> unsigned int Omega<CostModel>::GetNbSegments() const{return(nbSegments);}
 
 //####### initialize_LP_ts #######// //####### initialize_LP_ts #######// //####### initialize_LP_ts #######//
 //####### initialize_LP_ts #######// //####### initialize_LP_ts #######// //####### initialize_LP_ts #######//
-// initialize LP_ts for all t and s
-// t = 0 for all s : LP_ts[0][s] = addFirstPiece(new Piece(Track(), Interval(mini, maxi), 0 or +INFINITY));
-// t > 1 for all s : LP_ts[t][s] = addFirstPiece(new Piece(Track(), Interval(mini, maxi), +INFINITY));
+// initialize LP_ts for t = 0 and all s : LP_ts[0][s] = addFirstPiece(Piece(Track(), Interval(mini, maxi), 0 or +INFINITY));
+// the rows t > 0 are created by the forward pass when it reaches them (initialize_LP_ts_row)
 
-void Omega::initialize_LP_ts(unsigned int n)
+template<typename CostModel>
+void Omega<CostModel>::initialize_LP_ts(unsigned int n)
 {
-  Interval inter = cost_interval(); ///get the cost-dependent interval
-  double mini = inter.geta();
-  double maxi = inter.getb();
+  Interval inter = CostModel::cost_interval(); ///get the cost-dependent interval
   unsigned int nbR = m_graph.nb_rows();
 
-  LP_ts = new ListPiece*[n + 1];
-  for(unsigned int i = 0; i < (n + 1); i++){LP_ts[i] = new ListPiece[p]; for(unsigned int j = 0; j < p; j++){LP_ts[i][j] = ListPiece();}}
-
   ///REVEAL NODE BOUNDARIES IF ANY
   ///REVEAL NODE BOUNDARIES IF ANY
-  for(unsigned char j = 0; j < p; j++)
+  nodeBounds = std::vector<Interval>(p, inter);
+  for(unsigned int k = q; k < nbR; k++) ///after the q edges
   {
-    for(unsigned char k = q; k < nbR; k++) ///after the q edges
-    {
-      if((m_graph.getEdge(k).getConstraint() == "node") && (m_graph.getEdge(k).getState1() == j))
-      {
-        mini = m_graph.getEdge(k).getMinn();
-        maxi = m_graph.getEdge(k).getMaxx();
-      }
-    }
-    LP_ts[0][j].addFirstPiece(new Piece(Track(), Interval(mini, maxi), Cost()));
-
-    for(unsigned int i = 1; i < (n + 1); i++)
+    if(m_graph.getEdge(k).getConstraint() == "node")
     {
-      LP_ts[i][j].addFirstPiece(new Piece(Track(), Interval(mini, maxi), Cost()));
-      LP_ts[i][j].setUniquePieceCostToInfinity();
+      nodeBounds[m_graph.getEdge(k).getState1()] = Interval(m_graph.getEdge(k).getMinn(), m_graph.getEdge(k).getMaxx());
     }
-    mini = inter.geta();
-    maxi = inter.getb();
   }
 
+  LP_ts = new ListPiece<CostModel>*[n + 1];
+  for(unsigned int i = 0; i < (n + 1); i++){LP_ts[i] = NULL;}
+
+  LP_ts[0] = new ListPiece<CostModel>[p];
+  for(unsigned int j = 0; j < p; j++){LP_ts[0][j].addFirstPiece(Piece<CostModel>(Track(), nodeBounds[j], Cost()));}
+
   ///START STATE CONSTRAINT
   ///START STATE CONSTRAINT
   std::vector<unsigned int> startState = m_graph.getStartState();
@@ -93,6 +99,22 @@ void Omega::initialize_LP_ts(unsigned int n)
         {LP_ts[0][j].setUniquePieceCostToInfinity();}
     }
   }
+  for(unsigned int j = 0; j < p; j++){if(m_edges.hasStdOut[j] == true){LP_ts[0][j].updateMinimum();}}
+}
+
+//####### initialize_LP_ts_row #######// //####### initialize_LP_ts_row #######// //####### initialize_LP_ts_row #######//
+//####### initialize_LP_ts_row #######// //####### initialize_LP_ts_row #######// //####### initialize_LP_ts_row #######//
+// t > 0 for all s : LP_ts[t][s] = addFirstPiece(Piece(Track(), nodeBounds[s], +INFINITY));
+
+template<typename CostModel>
+void Omega<CostModel>::initialize_LP_ts_row(unsigned int t)
+{
+  LP_ts[t] = new ListPiece<CostModel>[p];
+  for(unsigned int j = 0; j < p; j++)
+  {
+    LP_ts[t][j].addFirstPiece(Piece<CostModel>(Track(), nodeBounds[j], Cost()));
+    LP_ts[t][j].setUniquePieceCostToInfinity();
+  }
 }
 
 //####### gfpop BEGIN #######// //####### gfpop BEGIN #######// //####### gfpop BEGIN #######//
@@ -100,17 +122,62 @@ void Omega::initialize_LP_ts(unsigned int n)
 //####### gfpop BEGIN #######// //####### gfpop BEGIN #######// //####### gfpop BEGIN #######//
 //####### gfpop BEGIN #######// //####### gfpop BEGIN #######// //####### gfpop BEGIN #######//
 
-void Omega::gfpop(Data const& data)
+template<typename CostModel>
+void Omega<CostModel>::gfpop(Data const& data)
+{
+  std::vector<Cost> costs = dataCosts(data);
+  gfpop(costs);
+}
+
+//####### dataCosts #######// //####### dataCosts #######// //####### dataCosts #######//
+//####### dataCosts #######// //####### dataCosts #######// //####### dataCosts #######//
+// cost of each data point, computed once (and shared by the Omega of a penalty grid)
+
+template<typename CostModel>
+std::vector<Cost> Omega<CostModel>::dataCosts(Data const& data)
+{
+  Point* myData = data.getVecPt(); // GET the data = vector of Point = myData
+  std::vector<Cost> costs(data.getn());
+  for(unsigned int t = 0; t < data.getn(); t++)
+  {
+    double* coeff = CostModel::cost_coeff(myData[t]);
+    costs[t] = Cost(coeff);
+    delete [] coeff;
+  }
+  return(costs);
+}
+
+//####### gfpop on the costs of the data points #######// //####### gfpop on the costs of the data points #######//
+//####### gfpop on the costs of the data points #######// //####### gfpop on the costs of the data points #######//
+
+template<typename CostModel>
+void Omega<CostModel>::gfpop(std::vector<Cost> const& costs)
 {
-	Point* myData = data.getVecPt(); // GET the data = vector of Point = myData
-  n = data.getn(); // data length
+  m_costs = &costs[0];
+  n = costs.size(); // data length
 	initialize_LP_ts(n); // Initialize LP_ts Piece : size LP_ts (n+1) x p
 
+  bool storeTrace = (m_storage == "trace" || m_storage == "disk");
+  bool costOnly = (m_storage == "cost");
+  if(m_storage == "trace"){trace.initialize(n, p);}
+  if(m_storage == "disk"){trace.initialize(n, p, m_file);}
+
+  bool storeCheckpoints = (m_storage == "checkpoint");
+  if(storeCheckpoints == true)
+  {
+    if(m_checkpoint == 0){m_checkpoint = (unsigned int) ceil(sqrt((double) n));}
+    firstRecomputed = 0;
+    lastRecomputed = 0;
+  }
+
 	for(unsigned int t = 0; t < n; t++) // loop for all data point
 	{
 	  //std::cout << t << "-----------------------------------------------------------------------------------------------------------------------" << std::endl;
-	  LP_edges_operators(t); // fill_LP_edges. t = newLabel to consider
-    LP_edges_addPointAndPenalty(myData[t]); // Add new data point and penalty
+    if(LP_ts[t + 1] == NULL){initialize_LP_ts_row(t + 1);} // row t + 1 created when the forward pass reaches it
+    if(storeTrace == true){trace.addRow(LP_ts[t]);} // before the null edges take the Pieces of LP_ts[t]
+    bool releasedRow = (storeTrace == true) || (costOnly == true) || ((storeCheckpoints == true) && (t % m_checkpoint != 0));
+	  LP_edges_operators(t, releasedRow); // fill_LP_edges. t = newLabel to consider
+    LP_edges_addPointAndPenalty(m_costs[t]); // Add new data point and penalty
 
     ////////////////
     ////////////////
@@ -132,8 +199,27 @@ void Omega::gfpop(Data const& data)
 	  //LP_ts[t+1][0].show();
 	  //std::cout << "ZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZ"<< t<< std::endl;
 
+    if(storeTrace == true) // LP_ts[t] is no more used by the forward pass
+    {
+      delete [] (LP_ts[t]);
+      LP_ts[t] = NULL;
+    }
+
+    if((storeCheckpoints == true) && (t % m_checkpoint != 0)) // only the rows LP_ts[k * m_checkpoint] are kept
+    {
+      delete [] (LP_ts[t]);
+      LP_ts[t] = NULL;
+    }
+
+    if(costOnly == true) // LP_ts[t] is no more used
+    {
+      delete [] (LP_ts[t]);
+      LP_ts[t] = NULL;
+    }
 	}
 
+  if(storeTrace == true){trace.close();}
+  if(costOnly == true){finalCost(); return;}
 	backtracking();
 }
 
@@ -145,67 +231,140 @@ void Omega::gfpop(Data const& data)
 //##### LP_edges_operators #####//////##### LP_edges_operators #####//////##### LP_edges_operators #####///
 //##### LP_edges_operators #####//////##### LP_edges_operators #####//////##### LP_edges_operators #####///
 
-void Omega::LP_edges_operators(unsigned int t)
+template<typename CostModel>
+void Omega<CostModel>::LP_edges_operators(unsigned int t, bool releasedRow)
 {
-  for(unsigned int i = 0 ; i < q ; i++) /// loop for all q edges
+  // COMMENT: i-th edge = index i in m_edges
+  // COMMENT: starting state = m_edges.state1[i]
+  // COMMENT: t is the label to associate to the constraint
+  // COMMENT: LP_edges[i] only depends on LP_ts[t] -> the q edges can be processed in parallel
+  // COMMENT: "cost" storage: the label counts the changepoints (a non null edge at t > 0 starts a new segment)
+  // COMMENT: the up (down) edges leaving the same state copy the operator result of the first one (m_edges.sharedOperator)
+  // COMMENT: -> one operator per (state, direction), then each edge applies its own parameter
+  // COMMENT: releasedRow = LP_ts[t] deleted after this step -> the last null edge leaving a state takes its Pieces
+  // COMMENT: (no copy) once all the other edges have read them
+  bool countChangepoints = (m_storage == "cost" && t > 0);
+  bool separateParameter = (m_edges.hasSharedOperator == true || releasedRow == true);
+  auto takesPieces = [this, releasedRow](unsigned int i){return(releasedRow == true && m_edges.lastNull[i] == true);};
+
+  auto edgeOperator = [this, t, countChangepoints, separateParameter, &takesPieces](unsigned int i)
+  {
+    if(m_edges.sharedOperator[i] != i || takesPieces(i) == true){return;}
+    LP_edges[i].LP_edges_constraint(LP_ts[t][m_edges.state1[i]], m_edges.kind[i], m_edges.state1[i], t);
+    if(countChangepoints == true && m_edges.kind[i] != EDGE_NULL){LP_edges[i].countChangepoints(LP_ts[t][m_edges.state1[i]]);}
+    if(separateParameter == false){LP_edges[i].LP_edges_parameter(m_edges.kind[i], m_edges.parameter[i]);}
+  };
+  auto edgeShared = [this](unsigned int i)
+    {if(m_edges.sharedOperator[i] != i){LP_edges[i].copy(LP_edges[m_edges.sharedOperator[i]]);}};
+  auto edgeParameter = [this](unsigned int i){LP_edges[i].LP_edges_parameter(m_edges.kind[i], m_edges.parameter[i]);};
+
+  if(m_pool != NULL){m_pool->parallelFor(q, edgeOperator);}
+  else{for(unsigned int i = 0 ; i < q ; i++){edgeOperator(i);}} /// loop for all q edges
+  if(separateParameter == false){return;}
+
+  if(m_edges.hasSharedOperator == true)
+  {
+    if(m_pool != NULL){m_pool->parallelFor(q, edgeShared);}
+    else{for(unsigned int i = 0 ; i < q ; i++){edgeShared(i);}}
+  }
+  for(unsigned int i = 0 ; i < q ; i++) /// O(1) each
   {
-    // COMMENT: i-th edge = m_graph.getEdge(i)
-    // COMMENT: starting state = m_graph.getEdge(i).getState1()
-    // COMMENT: t is the label to associate to the constraint
-    LP_edges[i].LP_edges_constraint(LP_ts[t][m_graph.getEdge(i).getState1()], m_graph.getEdge(i), t);
+    if(takesPieces(i) == true){LP_edges[i].take(LP_ts[t][m_edges.state1[i]]);}
   }
+  if(m_pool != NULL){m_pool->parallelFor(q, edgeParameter);}
+  else{for(unsigned int i = 0 ; i < q ; i++){edgeParameter(i);}}
 }
 
 //##### LP_edges_addPointAndPenalty #####//////##### LP_edges_addPointAndPenalty #####//////##### LP_edges_addPointAndPenalty #####///
 //##### LP_edges_addPointAndPenalty #####//////##### LP_edges_addPointAndPenalty #####//////##### LP_edges_addPointAndPenalty #####///
 
-void Omega::LP_edges_addPointAndPenalty(Point const& pt)
+template<typename CostModel>
+void Omega<CostModel>::LP_edges_addPointAndPenalty(Cost const& costPt)
 {
-  for(unsigned char i = 0; i < q; i++) /// loop for all q edges
-  {
-    // COMMENT: LP_edges[i] = i-th edge = m_graph.getEdge(i) BECAUSE we need K, a and penalty
-    LP_edges[i].LP_edges_addPointAndPenalty(m_graph.getEdge(i), pt);
-  }
+  // COMMENT: LP_edges[i] = i-th edge BECAUSE we need K, a and penalty
+  auto edgeAddPoint = [this, &costPt](unsigned int i)
+    {LP_edges[i].LP_edges_addPointAndPenalty(m_edges.KK[i], m_edges.aa[i], m_edges.beta[i], costPt);};
+
+  if(m_pool != NULL){m_pool->parallelFor(q, edgeAddPoint); return;}
+  for(unsigned int i = 0; i < q; i++){edgeAddPoint(i);} /// loop for all q edges
 }
 
 //##### multipleMinimization_LP_edges #####//////##### multipleMinimization_LP_edges #####//////##### multipleMinimization_LP_edges #####///
 //##### multipleMinimization_LP_edges #####//////##### multipleMinimization_LP_edges #####//////##### multipleMinimization_LP_edges #####///
 
-void Omega::LP_t_new_multipleMinimization(unsigned int t)
+template<typename CostModel>
+void Omega<CostModel>::LP_t_new_multipleMinimization(unsigned int t)
 {
   // COMMENT: m_graph was rearranged with increasing integer state2 AND increasing beta penalty
-  // COMMENT: LP_ts[t + 1][j] initialized in initialize_LP_ts by addFirstPiece(new Piece(Track(), Interval(mini, maxi), +INFINITY))
-  unsigned int k = 0;
-  for(unsigned int j = 0 ; j < p; j++)
+  // COMMENT: LP_ts[t + 1][j] initialized in initialize_LP_ts by addFirstPiece(Piece(Track(), Interval(mini, maxi), +INFINITY))
+  // COMMENT: state j only uses its incoming edges -> the p states can be processed in parallel
+  auto stateMinimization = [this, t](unsigned int j)
+  {
+    for(unsigned int k = m_edges.firstIncoming[j]; k < m_edges.lastIncoming[j]; k++)
+    {
+      LP_ts[t + 1][j].LP_ts_Minimization(LP_edges[k], m_context);
+    }
+    if(m_edges.hasStdOut[j] == true){LP_ts[t + 1][j].updateMinimum();} ///used by the std edges leaving j at time t + 1
+  };
+
+  if(m_pool != NULL)
   {
-    while((k < q) && (m_graph.getEdge(k).getState2() == j))
+    ///balance: the states with the most Pieces to process are started first (the threads take the next state when done)
+    stateWork.assign(p, 0);
+    stateOrder.resize(p);
+    for(unsigned int j = 0 ; j < p; j++)
     {
-      LP_ts[t + 1][j].LP_ts_Minimization(LP_edges[k]);
-      k = k + 1;
+      stateOrder[j] = j;
+      for(unsigned int k = m_edges.firstIncoming[j]; k < m_edges.lastIncoming[j]; k++){stateWork[j] = stateWork[j] + LP_edges[k].size() + 1;}
     }
+    std::vector<std::size_t> const& work = stateWork;
+    std::stable_sort(stateOrder.begin(), stateOrder.end(), [&work](unsigned int a, unsigned int b){return(work[a] > work[b]);});
+
+    auto orderedStateMinimization = [this, &stateMinimization](unsigned int i){stateMinimization(stateOrder[i]);};
+    m_pool->parallelFor(p, orderedStateMinimization);
+    return;
   }
+  for(unsigned int j = 0 ; j < p; j++){stateMinimization(j);}
 }
 
 
-//##### backtracking #####//////##### backtracking #####//////##### backtracking #####///
-//##### backtracking #####//////##### backtracking #####//////##### backtracking #####///
+//##### recompute_LP_ts #####//////##### recompute_LP_ts #####//////##### recompute_LP_ts #####///
+//##### recompute_LP_ts #####//////##### recompute_LP_ts #####//////##### recompute_LP_ts #####///
+// "checkpoint" storage: build again the rows from the last kept row before t up to the row t
+// the rows of the previous recomputation are deleted (backtracking only goes back in time)
 
-void Omega::backtracking()
+template<typename CostModel>
+void Omega<CostModel>::recompute_LP_ts(unsigned int t)
 {
-  Interval constrainedInterval; // Interval to fit the constraints
+  for(unsigned int i = firstRecomputed; i <= lastRecomputed; i++)
+  {
+    if(i % m_checkpoint != 0 && i < n){delete [] (LP_ts[i]); LP_ts[i] = NULL;}
+  }
 
-  double* malsp = new double[5];
-  double* malsp_temp = new double[5];
-  //Interval* nodeConstr = m_graph.nodeConstraints();
+  unsigned int checkpoint = t - (t % m_checkpoint);
+  for(unsigned int i = checkpoint; i < t; i++)
+  {
+    initialize_LP_ts_row(i + 1);
+    LP_edges_operators(i);
+    LP_edges_addPointAndPenalty(m_costs[i]);
+    LP_t_new_multipleMinimization(i);
+  }
+  firstRecomputed = checkpoint + 1;
+  lastRecomputed = t;
+}
+
+
+//##### finalState #####//////##### finalState #####//////##### finalState #####///
+//##### finalState #####//////##### finalState #####//////##### finalState #####///
+// best state at time n (among the end states if any), malsp = get_min_argmin_label_state_position_ListPiece of this state
 
+template<typename CostModel>
+unsigned int Omega<CostModel>::finalState(double* malsp) const
+{
+  double* malsp_temp = new double[5];
   LP_ts[n][0].get_min_argmin_label_state_position_ListPiece(malsp);
 
-  ///////////////////
-  /// FINAL STATE ///
-  ///////////////////
-  unsigned int CurrentState = 0; // Current state
-  unsigned int CurrentChgpt = n; // data(1)....data(n). Last data index in each segment
-  double CurrentGlobalCost;
+  unsigned int bestState = 0;
   std::vector<unsigned int> endState = m_graph.getEndState();
 
   // IF no endState, all the states are endstates.
@@ -214,7 +373,7 @@ void Omega::backtracking()
     for (unsigned int j = 1 ; j < p ; j++) // for all p states
     {
       LP_ts[n][j].get_min_argmin_label_state_position_ListPiece(malsp_temp);
-      if(malsp_temp[0] < malsp[0]){CurrentState = j; malsp[0] = malsp_temp[0];}
+      if(malsp_temp[0] < malsp[0]){bestState = j; malsp[0] = malsp_temp[0];}
     }
   }
   else
@@ -222,13 +381,53 @@ void Omega::backtracking()
     for (unsigned int j = 0 ; j < endState.size() ; j++) // for all endState available
     {
       LP_ts[n][endState[j]].get_min_argmin_label_state_position_ListPiece(malsp_temp);
-      if(malsp_temp[0] < malsp[0]){CurrentState = endState[j]; malsp[0] = malsp_temp[0];}
+      if(malsp_temp[0] < malsp[0]){bestState = endState[j]; malsp[0] = malsp_temp[0];}
     }
   }
+  delete [] malsp_temp;
 
   ///// with the best state
-  LP_ts[n][CurrentState].get_min_argmin_label_state_position_ListPiece(malsp);
+  LP_ts[n][bestState].get_min_argmin_label_state_position_ListPiece(malsp);
+  return(bestState);
+}
+
+//##### finalCost #####//////##### finalCost #####//////##### finalCost #####///
+//##### finalCost #####//////##### finalCost #####//////##### finalCost #####///
+// "cost" storage: no backtracking. Global cost (penalties included) and number of segments counted in the labels
+
+template<typename CostModel>
+void Omega<CostModel>::finalCost()
+{
+  double* malsp = new double[5];
+  finalState(malsp);
+  penalizedCost = malsp[0];
+  globalCost = malsp[0];
+  penalty = NAN;
+  nbSegments = (unsigned int) malsp[2] + 1;
+  delete [] malsp;
+}
+
+//##### backtracking #####//////##### backtracking #####//////##### backtracking #####///
+//##### backtracking #####//////##### backtracking #####//////##### backtracking #####///
+
+template<typename CostModel>
+void Omega<CostModel>::backtracking()
+{
+  Interval constrainedInterval; // Interval to fit the constraints
+
+  double* malsp = new double[5];
+  //Interval* nodeConstr = m_graph.nodeConstraints();
+
+  ///////////////////
+  /// FINAL STATE ///
+  ///////////////////
+  unsigned int CurrentState = finalState(malsp); // Current state
+  unsigned int CurrentChgpt = n; // data(1)....data(n). Last data index in each segment
+  double CurrentGlobalCost;
   CurrentGlobalCost = malsp[0];
+  penalizedCost = malsp[0];
+  penalty = 0;
+  if(malsp[2] > 0){penalty = penalty + m_edges.findBeta(malsp[3], CurrentState);}
   parameters.push_back(malsp[1]); // = argmin
   changepoints.push_back(CurrentChgpt); // = n
   states.push_back(CurrentState); // = the best state
@@ -248,19 +447,24 @@ void Omega::backtracking()
   {
     out = false;
     boolForced = false;
-    decay = m_graph.recursiveState(CurrentState);
+    decay = m_edges.recursiveState(CurrentState);
     if(decay != 1){correction = std::pow(decay, parameters.back() - malsp[2] + 1);}else{correction = 1;}
 
-    constrainedInterval = m_graph.buildInterval(malsp[1]*correction, malsp[3], CurrentState, out); ///update out
+    constrainedInterval = m_edges.buildInterval<CostModel>(malsp[1]*correction, malsp[3], CurrentState, out); ///update out
 
     CurrentState = malsp[3];
     CurrentChgpt = malsp[2];
 
     //TO UPDATE: malsp[4] = position
-    LP_ts[(int) malsp[2]][(int) malsp[3]].get_min_argmin_label_state_position_onePiece(malsp, (int) malsp[4], constrainedInterval, out, boolForced); ///update boolForced
+    if((m_storage == "checkpoint") && (LP_ts[(int) malsp[2]] == NULL)){recompute_LP_ts((int) malsp[2]);}
+    if(LP_ts[(int) malsp[2]] != NULL)
+      {LP_ts[(int) malsp[2]][(int) malsp[3]].get_min_argmin_label_state_position_onePiece(malsp, (int) malsp[4], constrainedInterval, out, boolForced);} ///update boolForced
+    else
+      {trace.get_argmin_label_state_position_onePiece<CostModel>(malsp, (int) malsp[2], (int) malsp[3], (int) malsp[4], constrainedInterval, out, boolForced);} ///update boolForced
 
     //update CurrentGlobalCost and boolForced if argmin on a bound
-    CurrentGlobalCost = CurrentGlobalCost - m_graph.findBeta(malsp[3], CurrentState);
+    CurrentGlobalCost = CurrentGlobalCost - m_edges.findBeta(malsp[3], CurrentState);
+    if(malsp[2] > 0){penalty = penalty + m_edges.findBeta(malsp[3], CurrentState);}
     //if(malsp[1] == nodeConstr[CurrentState].geta() || malsp[1] == nodeConstr[CurrentState].getb()){boolForced = true;}
 
     parameters.push_back(malsp[1]);
@@ -270,8 +474,8 @@ void Omega::backtracking()
   }
 
   globalCost = CurrentGlobalCost;
+  nbSegments = changepoints.size();
   delete(malsp);
-  delete(malsp_temp);
   //delete(nodeConstr);
 }
 
@@ -280,7 +484,8 @@ void Omega::backtracking()
 ///###///###///###///###///###///###///###///###///###///###///###///###///###///###///###
 ///###///###///###///###///###///###///###///###///###///###///###///###///###///###///###
 
-void Omega::show()
+template<typename CostModel>
+void Omega<CostModel>::show()
 {
   for(unsigned char i = 0; i < q; i++)
   {
@@ -289,3 +494,12 @@ void Omega::show()
     LP_edges[i].show();
   }
 }
+
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+
+template class Omega<MeanCost>;
+template class Omega<VarianceCost>;
+template class Omega<PoissonCost>;
+template class Omega<ExpCost>;
+template class Omega<NegbinCost>;
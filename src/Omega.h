@@ -3,18 +3,25 @@
 
 #include"Data.h"
 #include"Graph.h"
+#include "CompiledGraph.h"
 #include"Edge.h"
 #include "ListPiece.h"
 #include "Piece.h"
+#include "Trace.h"
+#include "Context.h"
+#include "ThreadPool.h"
 
 #include <math.h>
 #include<vector>
+#include<string>
 #include <stdlib.h>
 
+/// CostModel = MeanCost, VarianceCost, PoissonCost, ExpCost or NegbinCost (see CostModel.h)
+template<typename CostModel>
 class Omega
 {
   public:
-    Omega(Graph graph);
+    Omega(Graph graph, std::string storage = "full", unsigned int checkpoint = 0, std::string file = "", Context const& context = Context());
     ~Omega();
 
     std::vector< int > GetChangepoints() const;
@@ -22,35 +29,63 @@ class Omega
     std::vector< int > GetStates() const;
     std::vector< int > GetForced() const;
     double GetGlobalCost() const;
+    double GetPenalizedCost() const;
+    double GetPenalty() const;
+    unsigned int GetNbSegments() const;
 
     ///////////////
     void initialize_LP_ts(unsigned int n);
+    void initialize_LP_ts_row(unsigned int t);
     void gfpop(Data const& data);
+    void gfpop(std::vector<Cost> const& costs);
+    static std::vector<Cost> dataCosts(Data const& data);
 
     ///////////////
-    void LP_edges_operators(unsigned int t);
-    void LP_edges_addPointAndPenalty(Point const& pt);
+    void LP_edges_operators(unsigned int t, bool releasedRow = false);
+    void LP_edges_addPointAndPenalty(Cost const& costPt);
     void LP_t_new_multipleMinimization(unsigned int t);
+    void recompute_LP_ts(unsigned int t);
+    unsigned int finalState(double* malsp) const;
     void backtracking();
+    void finalCost();
     void show();
 
   private:
+    Context m_context; ///parameters of the run (no global state: several Omega can run in parallel)
+    ThreadPool* m_pool; ///threads of the forward pass if m_context.m_nbThreads > 1 (NULL otherwise)
+    std::vector<unsigned int> stateOrder; ///parallel minimization: the states sorted by decreasing work at the current step
+    std::vector<std::size_t> stateWork; ///parallel minimization: number of Pieces to process for each state
     Graph m_graph; ///graph of the constraints. 9 variables
+    CompiledGraph m_edges; ///the q edges of m_graph decoded for the forward pass
     unsigned int p;   ///number of states in the graph = number of columns in the matrix Q_ts
     unsigned int q; ///number of edges in the graph = number of elements in the object Q_edges
 
     unsigned int n; //size of the data
-    ListPiece* LP_edges; /// transformed cost by the operators for each edge (size 1 x q)
-    ListPiece** LP_ts;  ///cost function Q with respect to position t and state s (size t x p), t = vector size.
+    ListPiece<CostModel>* LP_edges; /// transformed cost by the operators for each edge (size 1 x q)
+    ListPiece<CostModel>** LP_ts;  ///cost function Q with respect to position t and state s (size t x p), t = vector size.
+
+    std::vector<Interval> nodeBounds; ///interval of the parameter for each state (node constraints if any)
+
+    std::string m_storage; ///"full" = keep all the rows LP_ts[t]. "trace" = keep only a Trace of the consumed rows. "disk" = idem with the Trace in the file m_file. "checkpoint" = keep one row every m_checkpoint rows. "cost" = keep only the rows t and t + 1, no backtracking (global cost and number of segments only)
+    Trace trace; ///compact backtracking information of the rows LP_ts[t] (t < n) freed in "trace" and "disk" storages
+    std::string m_file; ///"disk" storage: binary file of the Trace (deleted with Omega)
+    unsigned int m_checkpoint; ///"checkpoint" storage: number of steps between two kept rows (0 = sqrt(n))
+    Cost const* m_costs; ///costs of the data points (given to gfpop). "checkpoint" storage: used to recompute the missing rows in backtracking
+    unsigned int firstRecomputed; ///"checkpoint" storage: rows LP_ts[firstRecomputed..lastRecomputed] rebuilt by recompute_LP_ts
+    unsigned int lastRecomputed;
 
     std::vector< int > changepoints; ///vector of changepoints build by fpop (first index of each segment). size c
     std::vector< double > parameters; ///vector of means build by fpop. size c
     std::vector< int > states; ///vector of states build by fpop. size c
     std::vector< int > forced; ///vector of forced = 0 or 1. 1 = forced value. size c-1
     double globalCost;
+    double penalizedCost; ///optimal value of the penalized problem (= cost of the segmentation + penalty)
+    double penalty; ///sum of the penalties of the edges creating the segments (segments with label > 0). NAN with "cost" storage
+    unsigned int nbSegments; ///number of segments
 };
 
-std::ostream &operator<<(std::ostream &s, const Omega &om);
+template<typename CostModel>
+std::ostream &operator<<(std::ostream &s, const Omega<CostModel> &om);
 
 
 #endif // OMEGA_H
@@ -6,8 +6,8 @@
 using namespace Rcpp;
 
 // gfpopTransfer
-List gfpopTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight);
-RcppExport SEXP _gfpop_gfpopTransfer(SEXP vectDataSEXP, SEXP mygraphSEXP, SEXP typeSEXP, SEXP vectWeightSEXP) {
+List gfpopTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight, std::string storage, unsigned int checkpoint, std::string file, unsigned int nthreads);
+RcppExport SEXP _gfpop_gfpopTransfer(SEXP vectDataSEXP, SEXP mygraphSEXP, SEXP typeSEXP, SEXP vectWeightSEXP, SEXP storageSEXP, SEXP checkpointSEXP, SEXP fileSEXP, SEXP nthreadsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -15,13 +15,97 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< DataFrame >::type mygraph(mygraphSEXP);
     Rcpp::traits::input_parameter< std::string >::type type(typeSEXP);
     Rcpp::traits::input_parameter< NumericVector >::type vectWeight(vectWeightSEXP);
-    rcpp_result_gen = Rcpp::wrap(gfpopTransfer(vectData, mygraph, type, vectWeight));
+    Rcpp::traits::input_parameter< std::string >::type storage(storageSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type checkpoint(checkpointSEXP);
+    Rcpp::traits::input_parameter< std::string >::type file(fileSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type nthreads(nthreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(gfpopTransfer(vectData, mygraph, type, vectWeight, storage, checkpoint, file, nthreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+
+// gfpopBatchTransfer
+List gfpopBatchTransfer(List listData, DataFrame mygraph, std::string type, List listWeight, std::string storage, unsigned int checkpoint, unsigned int nthreads);
+RcppExport SEXP _gfpop_gfpopBatchTransfer(SEXP listDataSEXP, SEXP mygraphSEXP, SEXP typeSEXP, SEXP listWeightSEXP, SEXP storageSEXP, SEXP checkpointSEXP, SEXP nthreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< List >::type listData(listDataSEXP);
+    Rcpp::traits::input_parameter< DataFrame >::type mygraph(mygraphSEXP);
+    Rcpp::traits::input_parameter< std::string >::type type(typeSEXP);
+    Rcpp::traits::input_parameter< List >::type listWeight(listWeightSEXP);
+    Rcpp::traits::input_parameter< std::string >::type storage(storageSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type checkpoint(checkpointSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type nthreads(nthreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(gfpopBatchTransfer(listData, mygraph, type, listWeight, storage, checkpoint, nthreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+
+// gfpopGridTransfer
+List gfpopGridTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight, NumericVector multipliers, std::string storage, unsigned int checkpoint, bool segmentations, unsigned int nthreads);
+RcppExport SEXP _gfpop_gfpopGridTransfer(SEXP vectDataSEXP, SEXP mygraphSEXP, SEXP typeSEXP, SEXP vectWeightSEXP, SEXP multipliersSEXP, SEXP storageSEXP, SEXP checkpointSEXP, SEXP segmentationsSEXP, SEXP nthreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type vectData(vectDataSEXP);
+    Rcpp::traits::input_parameter< DataFrame >::type mygraph(mygraphSEXP);
+    Rcpp::traits::input_parameter< std::string >::type type(typeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type vectWeight(vectWeightSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type multipliers(multipliersSEXP);
+    Rcpp::traits::input_parameter< std::string >::type storage(storageSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type checkpoint(checkpointSEXP);
+    Rcpp::traits::input_parameter< bool >::type segmentations(segmentationsSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type nthreads(nthreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(gfpopGridTransfer(vectData, mygraph, type, vectWeight, multipliers, storage, checkpoint, segmentations, nthreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+
+// gfpopCropsTransfer
+List gfpopCropsTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight, double minMultiplier, double maxMultiplier, std::string storage, unsigned int checkpoint, unsigned int nthreads);
+RcppExport SEXP _gfpop_gfpopCropsTransfer(SEXP vectDataSEXP, SEXP mygraphSEXP, SEXP typeSEXP, SEXP vectWeightSEXP, SEXP minMultiplierSEXP, SEXP maxMultiplierSEXP, SEXP storageSEXP, SEXP checkpointSEXP, SEXP nthreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type vectData(vectDataSEXP);
+    Rcpp::traits::input_parameter< DataFrame >::type mygraph(mygraphSEXP);
+    Rcpp::traits::input_parameter< std::string >::type type(typeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type vectWeight(vectWeightSEXP);
+    Rcpp::traits::input_parameter< double >::type minMultiplier(minMultiplierSEXP);
+    Rcpp::traits::input_parameter< double >::type maxMultiplier(maxMultiplierSEXP);
+    Rcpp::traits::input_parameter< std::string >::type storage(storageSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type checkpoint(checkpointSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type nthreads(nthreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(gfpopCropsTransfer(vectData, mygraph, type, vectWeight, minMultiplier, maxMultiplier, storage, checkpoint, nthreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+
+// itergfpopTransfer
+List itergfpopTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight, unsigned int iterMax, unsigned int Dinit, unsigned int nthreads);
+RcppExport SEXP _gfpop_itergfpopTransfer(SEXP vectDataSEXP, SEXP mygraphSEXP, SEXP typeSEXP, SEXP vectWeightSEXP, SEXP iterMaxSEXP, SEXP DinitSEXP, SEXP nthreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type vectData(vectDataSEXP);
+    Rcpp::traits::input_parameter< DataFrame >::type mygraph(mygraphSEXP);
+    Rcpp::traits::input_parameter< std::string >::type type(typeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type vectWeight(vectWeightSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type iterMax(iterMaxSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type Dinit(DinitSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type nthreads(nthreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(itergfpopTransfer(vectData, mygraph, type, vectWeight, iterMax, Dinit, nthreads));
     return rcpp_result_gen;
 END_RCPP
 }
 
 static const R_CallMethodDef CallEntries[] = {
-    {"_gfpop_gfpopTransfer", (DL_FUNC) &_gfpop_gfpopTransfer, 4},
+    {"_gfpop_gfpopTransfer", (DL_FUNC) &_gfpop_gfpopTransfer, 8},
+    {"_gfpop_gfpopBatchTransfer", (DL_FUNC) &_gfpop_gfpopBatchTransfer, 7},
+    {"_gfpop_gfpopGridTransfer", (DL_FUNC) &_gfpop_gfpopGridTransfer, 9},
+    {"_gfpop_gfpopCropsTransfer", (DL_FUNC) &_gfpop_gfpopCropsTransfer, 9},
+    {"_gfpop_itergfpopTransfer", (DL_FUNC) &_gfpop_itergfpopTransfer, 7},
     {NULL, NULL, 0}
 };
 
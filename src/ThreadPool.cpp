@@ -0,0 +1,129 @@
+#include "ThreadPool.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+///number of checks of a counter (generation or nbRunning) before waiting on a condition variable
+static const unsigned int spinCount = 2000;
+///the first pauseCount checks are separated by a pause instruction, the next ones by a yield
+static const unsigned int pauseCount = 100;
+
+//####### backOff #######////####### backOff #######////####### backOff #######//
+//####### backOff #######////####### backOff #######////####### backOff #######//
+// wait between two checks of a spin loop: pause (no memory-order flush, hyper-threaded sibling free),
+// then yield to let the thread we are waiting for run if it shares our core
+
+static void backOff(unsigned int spin)
+{
+  if(spin < pauseCount)
+  {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+  }
+  else{std::this_thread::yield();}
+}
+
+ThreadPool::ThreadPool(unsigned int nbThreads) : m_task(NULL), m_data(NULL), m_nbTasks(0), nextTask(0), nbRunning(0), generation(0), stop(false)
+{
+  for(unsigned int i = 1; i < nbThreads; i++){threads.push_back(std::thread(&ThreadPool::worker, this));}
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop.store(true);
+  }
+  wakeUp.notify_all();
+  for(unsigned int i = 0; i < threads.size(); i++){threads[i].join();}
+}
+
+unsigned int ThreadPool::size() const {return(threads.size() + 1);}
+
+unsigned int ThreadPool::usefulThreads(unsigned int nbThreads, unsigned int nbTasks)
+{
+  unsigned int nbCores = std::thread::hardware_concurrency();
+  if(nbCores > 0 && nbThreads > nbCores){nbThreads = nbCores;}
+  if(nbThreads > nbTasks){nbThreads = nbTasks;}
+  if(nbThreads < 1){nbThreads = 1;}
+  return(nbThreads);
+}
+
+//####### run #######////####### run #######////####### run #######//
+//####### run #######////####### run #######////####### run #######//
+
+void ThreadPool::run(unsigned int nbTasks, void (*task)(void*, unsigned int), void* data)
+{
+  if(threads.size() == 0 || nbTasks < 2)
+  {
+    for(unsigned int i = 0; i < nbTasks; i++){task(data, i);}
+    return;
+  }
+
+  m_task = task;
+  m_data = data;
+  m_nbTasks = nbTasks;
+  nextTask.store(0, std::memory_order_relaxed);
+  nbRunning.store(threads.size() + 1, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    generation.fetch_add(1, std::memory_order_release); ///publish the tasks
+  }
+  wakeUp.notify_all();
+
+  executeTasks();
+
+  ///barrier: spin with back-off, then wait for the notification of the last thread
+  unsigned int spin = 0;
+  while(nbRunning.load(std::memory_order_acquire) != 0 && spin < spinCount){backOff(spin); spin = spin + 1;}
+  if(nbRunning.load(std::memory_order_acquire) != 0)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    while(nbRunning.load(std::memory_order_acquire) != 0){allDone.wait(lock);}
+  }
+}
+
+//####### executeTasks #######////####### executeTasks #######////####### executeTasks #######//
+//####### executeTasks #######////####### executeTasks #######////####### executeTasks #######//
+
+void ThreadPool::executeTasks()
+{
+  unsigned int i = nextTask.fetch_add(1, std::memory_order_relaxed);
+  while(i < m_nbTasks)
+  {
+    m_task(m_data, i);
+    i = nextTask.fetch_add(1, std::memory_order_relaxed);
+  }
+  if(nbRunning.fetch_sub(1, std::memory_order_acq_rel) == 1) ///last thread: wake up run() if it waits
+  {
+    {std::lock_guard<std::mutex> lock(mutex);}
+    allDone.notify_one();
+  }
+}
+
+//####### worker #######////####### worker #######////####### worker #######//
+//####### worker #######////####### worker #######////####### worker #######//
+
+void ThreadPool::worker()
+{
+  unsigned int seen = 0; ///last generation executed
+  while(true)
+  {
+    unsigned int spin = 0;
+    while(generation.load(std::memory_order_acquire) == seen && stop.load() == false && spin < spinCount){backOff(spin); spin = spin + 1;}
+
+    if(generation.load(std::memory_order_acquire) == seen && stop.load() == false)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      while(generation.load(std::memory_order_acquire) == seen && stop.load() == false){wakeUp.wait(lock);}
+    }
+    if(stop.load() == true){return;}
+
+    seen = generation.load(std::memory_order_acquire);
+    executeTasks();
+  }
+}
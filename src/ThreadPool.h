@@ -0,0 +1,56 @@
+//  GPL-3 License
+// Copyright (c) 2019 Vincent Runge
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+/// persistent threads executing the tasks 0, 1, ..., nbTasks - 1 of a parallelFor
+/// the threads are created once (not at each time step) and wait for the next parallelFor:
+/// a short spin on an atomic counter (pause, then yield), then a condition variable (no CPU used between two runs)
+/// the calling thread waits for the end of a parallelFor in the same way
+/// the calling thread also executes tasks. The tasks are distributed by an atomic counter
+class ThreadPool
+{
+  public:
+    ThreadPool(unsigned int nbThreads);
+    ~ThreadPool();
+
+    unsigned int size() const; ///number of threads including the calling thread
+
+    ///nbThreads limited to the number of cores (spinning threads sharing a core are slower than a serial run) and to nbTasks
+    static unsigned int usefulThreads(unsigned int nbThreads, unsigned int nbTasks);
+
+    ///run function(i) for i = 0 to nbTasks - 1, returns when all the tasks are done
+    template<typename Function>
+    void parallelFor(unsigned int nbTasks, Function& function){run(nbTasks, &callFunction<Function>, &function);}
+
+  private:
+    template<typename Function>
+    static void callFunction(void* function, unsigned int i){(*static_cast<Function*>(function))(i);}
+
+    void run(unsigned int nbTasks, void (*task)(void*, unsigned int), void* data);
+    void executeTasks();
+    void worker();
+
+    std::vector<std::thread> threads;
+
+    void (*m_task)(void*, unsigned int); ///the current parallelFor
+    void* m_data;
+    unsigned int m_nbTasks;
+    std::atomic<unsigned int> nextTask; ///next task to execute
+    std::atomic<unsigned int> nbRunning; ///number of threads still executing tasks of the current parallelFor
+
+    std::atomic<unsigned int> generation; ///number of parallelFor started (the workers wait for a change)
+    std::atomic<bool> stop;
+    std::mutex mutex;
+    std::condition_variable wakeUp; ///a parallelFor is started (or stop)
+    std::condition_variable allDone; ///the last thread of a parallelFor has finished its tasks
+};
+
+#endif // THREADPOOL_H
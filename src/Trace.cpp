@@ -0,0 +1,171 @@
+#include "Trace.h"
+#include "ListPiece.h"
+#include "CostModel.h"
+
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+///number of TracePiece in a block
+static const std::size_t blockSize = 65536;
+///size of the write buffer of the file
+static const std::size_t streamBufferSize = 1 << 20;
+
+Trace::Trace()
+{
+  m_p = 0;
+  nbPieces = 0;
+  m_stream = NULL;
+  m_streamBuffer = NULL;
+  m_map = NULL;
+  m_mapSize = 0;
+}
+
+Trace::~Trace()
+{
+  if(m_stream != NULL){fclose(m_stream); m_stream = NULL;}
+  delete [] m_streamBuffer;
+#ifndef _WIN32
+  if(m_map != NULL){munmap(m_map, m_mapSize); m_map = NULL;}
+#else
+  if(m_map != NULL){UnmapViewOfFile(m_map); m_map = NULL;} ///before remove: a mapped file cannot be deleted
+#endif
+  if(m_file != ""){remove(m_file.c_str());}
+}
+
+//####### initialize #######////####### initialize #######////####### initialize #######//
+//####### initialize #######////####### initialize #######////####### initialize #######//
+
+void Trace::initialize(unsigned int n, unsigned int p, std::string file)
+{
+  m_p = p;
+  nbPieces = 0;
+  blocks.clear();
+  rowStart.clear();
+  rowStart.reserve((std::size_t) n * p + 1);
+  rowStart.push_back(0);
+
+  m_file = file;
+  if(m_file != "")
+  {
+    m_stream = fopen(m_file.c_str(), "wb");
+    if(m_stream == NULL){m_file = ""; throw std::runtime_error("Cannot open the storage file for writing");}
+    m_streamBuffer = new char[streamBufferSize];
+    setvbuf(m_stream, m_streamBuffer, _IOFBF, streamBufferSize);
+  }
+}
+
+//####### addRow #######////####### addRow #######////####### addRow #######//
+//####### addRow #######////####### addRow #######////####### addRow #######//
+// rows have to be added in increasing order t = 0, 1, 2...
+
+template<typename CostModel>
+void Trace::addRow(ListPiece<CostModel> const* row)
+{
+  for(unsigned int s = 0; s < m_p; s++)
+  {
+    row[s].trace(*this);
+    rowStart.push_back(nbPieces);
+  }
+}
+
+//####### addPiece #######////####### addPiece #######////####### addPiece #######//
+//####### addPiece #######////####### addPiece #######////####### addPiece #######//
+
+void Trace::addPiece(TracePiece const& tracePiece)
+{
+  if(m_stream != NULL)
+  {
+    if(fwrite(&tracePiece, sizeof(TracePiece), 1, m_stream) != 1){throw std::runtime_error("Cannot write in the storage file");}
+  }
+  else
+  {
+    if(nbPieces % blockSize == 0){blocks.push_back(std::vector<TracePiece>()); blocks.back().reserve(blockSize);}
+    blocks.back().push_back(tracePiece);
+  }
+  nbPieces = nbPieces + 1;
+}
+
+//####### close #######////####### close #######////####### close #######//
+//####### close #######////####### close #######////####### close #######//
+// end of the recording. The file (if any) is mapped in memory for the backtracking (mmap, MapViewOfFile on Windows)
+
+void Trace::close()
+{
+  if(m_stream == NULL){return;}
+  if(fclose(m_stream) != 0){m_stream = NULL; throw std::runtime_error("Cannot write in the storage file");}
+  m_stream = NULL;
+  delete [] m_streamBuffer;
+  m_streamBuffer = NULL;
+
+  m_mapSize = nbPieces * sizeof(TracePiece);
+#ifndef _WIN32
+  int fd = open(m_file.c_str(), O_RDONLY);
+  if(fd < 0){throw std::runtime_error("Cannot open the storage file for reading");}
+  void* map = mmap(NULL, m_mapSize, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd); ///the mapping stays valid
+  if(map == MAP_FAILED){throw std::runtime_error("Cannot map the storage file in memory");}
+  m_map = map;
+#else
+  HANDLE file = CreateFileA(m_file.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if(file == INVALID_HANDLE_VALUE){throw std::runtime_error("Cannot open the storage file for reading");}
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL); ///size 0 = the whole file (64-bit offsets)
+  CloseHandle(file); ///the mapping keeps the file open
+  if(mapping == NULL){throw std::runtime_error("Cannot map the storage file in memory");}
+  void* map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping); ///the view stays valid
+  if(map == NULL){throw std::runtime_error("Cannot map the storage file in memory");}
+  m_map = map;
+#endif
+}
+
+//####### getPiece #######////####### getPiece #######////####### getPiece #######//
+//####### getPiece #######////####### getPiece #######////####### getPiece #######//
+
+TracePiece Trace::getPiece(std::size_t index) const
+{
+  if(m_file == ""){return(blocks[index / blockSize][index % blockSize]);}
+  return(static_cast<TracePiece const*>(m_map)[index]);
+}
+
+//####### get_argmin_label_state_position_onePiece #######// //####### get_argmin_label_state_position_onePiece #######//
+//####### get_argmin_label_state_position_onePiece #######// //####### get_argmin_label_state_position_onePiece #######//
+// same response as ListPiece::get_min_argmin_label_state_position_onePiece except response[0] (the min), not available here
+
+template<typename CostModel>
+void Trace::get_argmin_label_state_position_onePiece(double* response, unsigned int t, unsigned int s, unsigned int position, Interval constrainedInterval, bool out, bool& forced) const
+{
+  TracePiece tracePiece = getPiece(rowStart[(std::size_t) t * m_p + s] + position - 1);
+  Cost cost = Cost();
+  cost.m_A = tracePiece.m_A;
+  cost.m_B = tracePiece.m_B;
+
+  response[1] = CostModel::cost_argminBacktrack(cost, tracePiece.m_interval);
+  response[2] = tracePiece.m_info.getLabel();
+  response[3] = tracePiece.m_info.getState();
+  response[4] = tracePiece.m_info.getPosition();
+
+  argminCorrection(response, constrainedInterval, out, forced);
+}
+
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+//####### explicit instantiations #######// //####### explicit instantiations #######//
+
+#define TRACE_INSTANTIATION(CostModel) \
+template void Trace::addRow<CostModel>(ListPiece<CostModel> const* row); \
+template void Trace::get_argmin_label_state_position_onePiece<CostModel>(double* response, unsigned int t, unsigned int s, unsigned int position, Interval constrainedInterval, bool out, bool& forced) const;
+
+TRACE_INSTANTIATION(MeanCost)
+TRACE_INSTANTIATION(VarianceCost)
+TRACE_INSTANTIATION(PoissonCost)
+TRACE_INSTANTIATION(ExpCost)
+TRACE_INSTANTIATION(NegbinCost)
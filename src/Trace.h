@@ -0,0 +1,63 @@
+//  GPL-3 License
+// Copyright (c) 2019 Vincent Runge
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "Track.h"
+#include "Interval.h"
+
+#include<vector>
+#include<string>
+#include<cstddef>
+#include<cstdio>
+
+template<typename CostModel> class ListPiece;
+
+///////////////////////////////////////////////////////////////
+//// TRACEPIECE STRUCTURE //// TRACEPIECE STRUCTURE
+///////////////////////////////////////////////////////////////
+/// What backtracking needs from a Piece: its Track, its interval and the
+/// two cost coefficients used by cost_argminBacktrack (no constant)
+struct TracePiece
+{
+  Track m_info;
+  Interval m_interval;
+  double m_A;
+  double m_B;
+};
+
+////////////////////////////////////////////////
+//// TRACE CLASS //// TRACE CLASS //// TRACE CLASS
+////////////////////////////////////////////////
+/// flat record of the rows LP_ts[t] already consumed by the forward pass
+/// kept in memory or, if a file is given, appended to this binary file and read back with mmap
+class Trace
+{
+  public:
+    Trace();
+    ~Trace();
+
+    void initialize(unsigned int n, unsigned int p, std::string file = "");
+    template<typename CostModel> void addRow(ListPiece<CostModel> const* row);
+    void addPiece(TracePiece const& tracePiece);
+    void close();
+
+    template<typename CostModel> void get_argmin_label_state_position_onePiece(double* response, unsigned int t, unsigned int s, unsigned int position, Interval constrainedInterval, bool out, bool& forced) const;
+
+  private:
+    TracePiece getPiece(std::size_t index) const;
+
+    unsigned int m_p; ///number of states
+    std::vector< std::vector<TracePiece> > blocks; ///all the recorded pieces, row after row, by blocks of fixed size (no reallocation of the recorded pieces)
+    std::size_t nbPieces; ///number of recorded pieces
+    std::vector<std::size_t> rowStart; ///index in pieces of the first piece of (t,s) at t * m_p + s. size (n * p + 1)
+
+    std::string m_file; ///binary file of TracePiece. "" = pieces kept in blocks
+    FILE* m_stream; ///m_file open for writing during the forward pass
+    char* m_streamBuffer; ///buffer of m_stream
+    void* m_map; ///m_file mapped in memory after close()
+    std::size_t m_mapSize;
+};
+
+#endif // TRACE_H
@@ -18,6 +18,7 @@ unsigned int Track::getLabel() const {return(myLabel);}
 unsigned int Track::getState() const {return(myParentState);}
 unsigned int Track::getPosition() const {return(myParentPosition);}
 
+void Track::setLabel(unsigned int label){myLabel = label;}
 void Track::setPosition(unsigned int position){myParentPosition = position;}
 void Track::setTrack(Track const& newTrack)
 {
@@ -25,5 +26,3 @@ void Track::setTrack(Track const& newTrack)
   myParentState = newTrack.getState();
   myParentPosition = newTrack.getPosition();
 }
-
-void Track::reversePosition(unsigned int length){myParentPosition = length - myParentPosition + 1;}
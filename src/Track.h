@@ -16,11 +16,10 @@ class Track
     unsigned int getState() const;
     unsigned int getPosition() const;
 
+    void setLabel(unsigned int label);
     void setPosition(unsigned int position);
     void setTrack(Track const& newTrack);
 
-    void reversePosition(unsigned int length);
-
   private:
     unsigned int myLabel; ///label of the Piece
     unsigned int myParentState; ///parent state of the Piece
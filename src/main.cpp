@@ -3,23 +3,357 @@
 #include<math.h>
 
 #include<Rcpp.h>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
 
 #include"Omega.h"
 #include"Cost.h"
-#include"ExternFunctions.h"
+#include"CostModel.h"
 
 #include"Data.h"
 #include"Graph.h"
 #include"Edge.h"
+#include"ThreadPool.h"
 
 using namespace Rcpp;
 
-// [[Rcpp::export]]
-List gfpopTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight)
+//####### Segmentation #######////####### Segmentation #######////####### Segmentation #######//
+//####### Segmentation #######////####### Segmentation #######////####### Segmentation #######//
+/// result of one Omega (filled by the threads of gfpopBatch and gfpopGrid, converted into a List by the calling thread)
+
+struct Segmentation
+{
+  std::vector< int > changepoints;
+  std::vector< int > states;
+  std::vector< int > forced;
+  std::vector< double > parameters;
+  double globalCost;
+  double penalizedCost; ///optimal value of the penalized problem
+  double penalty; ///sum of the penalties paid by the segmentation
+  unsigned int nbSegments; ///number of segments (the only result with the "cost" storage, with globalCost)
+  std::string error; ///message of the exception thrown by Omega if any
+};
+
+template<typename CostModel>
+void getSegmentation(Omega<CostModel> const& omega, Segmentation& seg)
+{
+  seg.changepoints = omega.GetChangepoints();
+  seg.states = omega.GetStates();
+  seg.forced = omega.GetForced();
+  seg.parameters = omega.GetParameters();
+  seg.globalCost = omega.GetGlobalCost();
+  seg.penalizedCost = omega.GetPenalizedCost();
+  seg.penalty = omega.GetPenalty();
+  seg.nbSegments = omega.GetNbSegments();
+}
+
+List segmentationList(Segmentation const& seg)
+{
+  List res = List::create(
+    _["changepoints"] = seg.changepoints,
+    _["states"] = seg.states,
+    _["forced"] = seg.forced,
+    _["param"] = seg.parameters,
+    _["cost"] = seg.globalCost
+);
+
+  return res;
+}
+
+//####### gfpopOmega #######////####### gfpopOmega #######////####### gfpopOmega #######//
+//####### gfpopOmega #######////####### gfpopOmega #######////####### gfpopOmega #######//
+/// run Omega with the cost model CostModel and return the segmentation
+
+template<typename CostModel>
+List gfpopOmega(Graph const& graph, Data const& data, std::string storage, unsigned int checkpoint, std::string file, unsigned int nthreads)
+{
+  Omega<CostModel> omega(graph, storage, checkpoint, file, Context(defaultEpsilon, nthreads));
+  omega.gfpop(data);
+
+  Segmentation seg;
+  getSegmentation(omega, seg);
+  return segmentationList(seg);
+}
+
+//####### gfpopBatchOmega #######////####### gfpopBatchOmega #######////####### gfpopBatchOmega #######//
+//####### gfpopBatchOmega #######////####### gfpopBatchOmega #######////####### gfpopBatchOmega #######//
+/// run one Omega per series on nthreads threads, the longest series first, and return the list of segmentations
+/// each Omega owns its memory: the threads share only the (read-only) graph and data
+
+template<typename CostModel>
+List gfpopBatchOmega(Graph const& graph, std::vector<Data*> const& data, std::string storage, unsigned int checkpoint, unsigned int nthreads)
+{
+  unsigned int m = data.size();
+  std::vector<Segmentation> segmentations(m);
+
+  std::vector<unsigned int> order(m);
+  for(unsigned int i = 0; i < m; i++){order[i] = i;}
+  std::stable_sort(order.begin(), order.end(), [&data](unsigned int a, unsigned int b){return(data[a]->getn() > data[b]->getn());});
+
+  auto segment = [&](unsigned int i)
+  {
+    try
+    {
+      Omega<CostModel> omega(graph, storage, checkpoint, "");
+      omega.gfpop(*data[order[i]]);
+      getSegmentation(omega, segmentations[order[i]]);
+    }
+    catch(std::exception const& e){segmentations[order[i]].error = e.what();}
+  };
+
+  ThreadPool pool(ThreadPool::usefulThreads(nthreads, m));
+  pool.parallelFor(m, segment);
+
+  List res(m);
+  for(unsigned int i = 0; i < m; i++)
+  {
+    if(segmentations[i].error != ""){throw std::runtime_error(segmentations[i].error);}
+    res[i] = segmentationList(segmentations[i]);
+  }
+  return res;
+}
+
+//####### gfpopGridOmega #######////####### gfpopGridOmega #######////####### gfpopGridOmega #######//
+//####### gfpopGridOmega #######////####### gfpopGridOmega #######////####### gfpopGridOmega #######//
+/// run one Omega per penalty multiplier on nthreads threads (penalties of graph multiplied by multipliers[i])
+/// the costs of the data points are computed once for all the Omega
+/// return the number of changepoints and the global cost for each multiplier (+ the segmentations if keepSegmentations)
+/// with the "cost" storage there is no backtracking (no segmentation) and the global cost is the penalized cost
+
+template<typename CostModel>
+List gfpopGridOmega(Graph const& graph, Data const& data, std::vector<double> const& multipliers, std::string storage, unsigned int checkpoint, bool keepSegmentations, unsigned int nthreads)
+{
+  unsigned int m = multipliers.size();
+  std::vector<Segmentation> segmentations(m);
+  std::vector<Cost> costs = Omega<CostModel>::dataCosts(data);
+
+  auto segment = [&](unsigned int i)
+  {
+    try
+    {
+      Graph scaledGraph = graph;
+      scaledGraph.scalePenalties(multipliers[i]);
+      Omega<CostModel> omega(scaledGraph, storage, checkpoint, "");
+      omega.gfpop(costs);
+      getSegmentation(omega, segmentations[i]);
+    }
+    catch(std::exception const& e){segmentations[i].error = e.what();}
+  };
+
+  ThreadPool pool(ThreadPool::usefulThreads(nthreads, m));
+  pool.parallelFor(m, segment);
+
+  std::vector< int > nbChangepoints(m);
+  std::vector< double > globalCosts(m);
+  for(unsigned int i = 0; i < m; i++)
+  {
+    if(segmentations[i].error != ""){throw std::runtime_error(segmentations[i].error);}
+    nbChangepoints[i] = segmentations[i].nbSegments - 1;
+    globalCosts[i] = segmentations[i].globalCost;
+  }
+
+  if(keepSegmentations == false){return(List::create(_["changepoints"] = nbChangepoints, _["cost"] = globalCosts));}
+
+  List allSegmentations(m);
+  for(unsigned int i = 0; i < m; i++){allSegmentations[i] = segmentationList(segmentations[i]);}
+  return(List::create(_["changepoints"] = nbChangepoints, _["cost"] = globalCosts, _["segmentations"] = allSegmentations));
+}
+
+//####### gfpopCropsOmega #######////####### gfpopCropsOmega #######////####### gfpopCropsOmega #######//
+//####### gfpopCropsOmega #######////####### gfpopCropsOmega #######////####### gfpopCropsOmega #######//
+/// all the optimal segmentations for a penalty multiplier m in [minMultiplier, maxMultiplier] (CROPS algorithm)
+/// a segmentation s has the penalized cost U_s + m * P_s (U_s = unpenalized cost, P_s = its penalty for m = 1)
+/// and the optimal cost is the minimum of these lines. Between two evaluated multipliers a < b with different
+/// segmentations, the next multiplier is the intersection of their lines: if the optimal cost there is on the lines,
+/// there is no other segmentation in [a, b], otherwise the new segmentation splits [a, b] in two intervals
+/// the intersections of all the open intervals are evaluated simultaneously on nthreads threads
+
+template<typename CostModel>
+List gfpopCropsOmega(Graph const& graph, Data const& data, double minMultiplier, double maxMultiplier, std::string storage, unsigned int checkpoint, unsigned int nthreads)
+{
+  std::vector<Cost> costs = Omega<CostModel>::dataCosts(data);
+  std::vector<double> multipliers; ///evaluated multipliers
+  std::vector<Segmentation> segmentations; ///segmentations[i] optimal for multipliers[i]
+  std::vector<double> unpenalized; ///U_s
+  std::vector<double> slope; ///P_s
+
+  ///evaluate the multipliers newMultipliers and add the results at the end of the vectors
+  ThreadPool pool(ThreadPool::usefulThreads(nthreads, nthreads));
+  auto evaluate = [&](std::vector<double> const& newMultipliers)
+  {
+    unsigned int first = multipliers.size();
+    unsigned int m = newMultipliers.size();
+    multipliers.insert(multipliers.end(), newMultipliers.begin(), newMultipliers.end());
+    segmentations.resize(first + m);
+
+    auto segment = [&](unsigned int i)
+    {
+      try
+      {
+        Graph scaledGraph = graph;
+        scaledGraph.scalePenalties(newMultipliers[i]);
+        Omega<CostModel> omega(scaledGraph, storage, checkpoint, "");
+        omega.gfpop(costs);
+        getSegmentation(omega, segmentations[first + i]);
+      }
+      catch(std::exception const& e){segmentations[first + i].error = e.what();}
+    };
+    pool.parallelFor(m, segment);
+
+    for(unsigned int i = first; i < first + m; i++)
+    {
+      if(segmentations[i].error != ""){throw std::runtime_error(segmentations[i].error);}
+      slope.push_back(segmentations[i].penalty / multipliers[i]);
+      unpenalized.push_back(segmentations[i].penalizedCost - segmentations[i].penalty);
+    }
+  };
+
+  ///the evaluations i and j give the same line (up to the rounding errors)
+  auto sameLine = [&](unsigned int i, unsigned int j)
+  {
+    double tolerance = 1e-8 * (1 + fabs(segmentations[i].penalizedCost) + fabs(segmentations[j].penalizedCost));
+    return(fabs(unpenalized[i] - unpenalized[j]) <= tolerance && fabs(slope[i] - slope[j]) * maxMultiplier <= tolerance);
+  };
+
+  evaluate(std::vector<double>(1, minMultiplier));
+  if(maxMultiplier > minMultiplier){evaluate(std::vector<double>(1, maxMultiplier));}
+
+  ///intervals (evaluation on the left, evaluation on the right) still to explore (open) or without other segmentation inside (closed)
+  std::vector< std::pair<unsigned int, unsigned int> > open;
+  std::vector< std::pair<unsigned int, unsigned int> > closed;
+  if(multipliers.size() == 2){open.push_back(std::make_pair(0, 1));}
+
+  while(open.size() > 0)
+  {
+    std::vector<double> newMultipliers;
+    std::vector< std::pair<unsigned int, unsigned int> > toEvaluate;
+    for(unsigned int k = 0; k < open.size(); k++)
+    {
+      unsigned int a = open[k].first;
+      unsigned int b = open[k].second;
+      double intersection = (unpenalized[b] - unpenalized[a]) / (slope[a] - slope[b]);
+      ///same segmentation or no intersection strictly inside ]a, b[ (rounding errors)
+      if(sameLine(a, b) || !(intersection > multipliers[a]) || !(intersection < multipliers[b])){closed.push_back(open[k]);}
+      else{newMultipliers.push_back(intersection); toEvaluate.push_back(open[k]);}
+    }
+    unsigned int first = multipliers.size();
+    evaluate(newMultipliers);
+
+    open.clear();
+    for(unsigned int k = 0; k < toEvaluate.size(); k++)
+    {
+      unsigned int a = toEvaluate[k].first;
+      unsigned int b = toEvaluate[k].second;
+      unsigned int c = first + k;
+      double onLines = unpenalized[a] + multipliers[c] * slope[a];
+      if(sameLine(a, c) || sameLine(b, c) || segmentations[c].penalizedCost >= onLines - 1e-8 * (1 + fabs(onLines))){closed.push_back(toEvaluate[k]);}
+      else{open.push_back(std::make_pair(a, c)); open.push_back(std::make_pair(c, b));}
+    }
+  }
+
+  ///the path: one segmentation per closed interval with different lines, optimal between two intersections
+  std::sort(closed.begin(), closed.end(), [&multipliers](std::pair<unsigned int, unsigned int> const& x, std::pair<unsigned int, unsigned int> const& y){return(multipliers[x.first] < multipliers[y.first]);});
+  std::vector<unsigned int> path(1, 0);
+  std::vector<double> lower(1, minMultiplier);
+  std::vector<double> upper;
+  for(unsigned int k = 0; k < closed.size(); k++)
+  {
+    unsigned int a = closed[k].first;
+    unsigned int b = closed[k].second;
+    if(sameLine(a, b)){continue;}
+    double intersection = (unpenalized[b] - unpenalized[a]) / (slope[a] - slope[b]);
+    if(!(intersection > multipliers[a]) || !(intersection < multipliers[b])){intersection = multipliers[b];}
+    upper.push_back(intersection);
+    lower.push_back(intersection);
+    path.push_back(b);
+  }
+  upper.push_back(maxMultiplier);
+
+  unsigned int m = path.size();
+  std::vector< int > nbSegments(m);
+  std::vector< double > unpenalizedCosts(m);
+  List allSegmentations(m);
+  for(unsigned int i = 0; i < m; i++)
+  {
+    nbSegments[i] = segmentations[path[i]].changepoints.size();
+    unpenalizedCosts[i] = unpenalized[path[i]];
+    allSegmentations[i] = segmentationList(segmentations[path[i]]);
+  }
+
+  return(List::create(_["lower"] = lower, _["upper"] = upper, _["segments"] = nbSegments, _["cost"] = unpenalizedCosts, _["evaluations"] = (int) multipliers.size(), _["segmentations"] = allSegmentations));
+}
+
+//####### gfpopIterOmega #######////####### gfpopIterOmega #######////####### gfpopIterOmega #######//
+//####### gfpopIterOmega #######////####### gfpopIterOmega #######////####### gfpopIterOmega #######//
+/// iterated gfpop with a Birgé Massart like penalty: the penalties of graph are multiplied by
+/// beta(D) = c1 * log(n) - c1 * (log(D) + 1) + c2 (c1 = 2, c2 = 5) with D the number of segments of the previous
+/// iteration, until beta is stable (or iterMax). The costs of the data points are computed once for all the iterations
+/// when D alternates between two values, the iterations would repeat the same two segmentations up to iterMax:
+/// we stop and return the segmentation of the last iteration (same parity as iterMax)
+
+double derivativePenalty(double D, double n)
+{
+  double c1 = 2;
+  double c2 = 5;
+  return(c1 * log(n) - c1 * (log(D) + 1) + c2);
+}
+
+template<typename CostModel>
+List gfpopIterOmega(Graph const& graph, Data const& data, unsigned int iterMax, unsigned int Dinit, unsigned int nthreads)
+{
+  std::vector<Cost> costs = Omega<CostModel>::dataCosts(data);
+  double n = data.getn();
+
+  unsigned int iter = 0;
+  double betaOld = 0;
+  double beta = derivativePenalty(Dinit, n);
+  std::vector< int > Dvect(1, Dinit);
+  Segmentation seg;
+  Segmentation previous;
+
+  while(beta != betaOld && iter <= iterMax)
+  {
+    Graph scaledGraph = graph;
+    scaledGraph.scalePenalties(beta);
+    Omega<CostModel> omega(scaledGraph, "full", 0, "", Context(defaultEpsilon, nthreads));
+    omega.gfpop(costs);
+    std::swap(previous, seg);
+    getSegmentation(omega, seg);
+
+    betaOld = beta;
+    int D = seg.changepoints.size();
+    Dvect.push_back(D);
+    beta = derivativePenalty(D, n);
+    iter = iter + 1;
+
+    ///2-cycle: D(iter) = D(iter - 2) != D(iter - 1)
+    unsigned int k = Dvect.size() - 1;
+    if(k >= 2 && beta != betaOld && Dvect[k] == Dvect[k - 2] && Dvect[k] != Dvect[k - 1])
+    {
+      if((iterMax - (iter - 1)) % 2 == 1){std::swap(previous, seg);}
+      break;
+    }
+  }
+
+  List res = List::create(
+    _["changepoints"] = seg.changepoints,
+    _["states"] = seg.states,
+    _["forced"] = seg.forced,
+    _["param"] = seg.parameters,
+    _["cost"] = seg.globalCost,
+    _["Dvect"] = Dvect
+);
+
+  return res;
+}
+
+//####### dataTransformation #######////####### dataTransformation #######////####### dataTransformation #######//
+//####### dataTransformation #######////####### dataTransformation #######////####### dataTransformation #######//
+/// check and transform vectData (in place) for the cost model type
+
+void dataTransformation(NumericVector vectData, std::string const& type)
 {
-  ///////////////////////////////////////////
-  /////////// DATA TRANSFORMATION ///////////
-  ///////////////////////////////////////////
   double epsilon = pow(10,-12);
 
   if(type == "variance")
@@ -61,21 +395,14 @@ List gfpopTransfer(NumericVector vectData, DataFrame mygraph, std::string type,
     disp = disp/k;
     for(int i = 0; i < vectData.size(); i++){vectData[i] = vectData[i]/disp; if(vectData[i] == 0){vectData[i] = epsilon/(1- epsilon);}}
   }
+}
 
-  // BEGIN TRANSFERT into C++ objects  // BEGIN TRANSFERT into C++ objects  // BEGIN TRANSFERT into C++ objects
-  // BEGIN TRANSFERT into C++ objects  // BEGIN TRANSFERT into C++ objects  // BEGIN TRANSFERT into C++ objects
-  // DATA AND GRAPH
-
-  /////////////////////////////////
-  /////////// DATA COPY ///////////
-  /////////////////////////////////
-  Data data = Data();
-  data.copy(vectData, vectWeight, vectData.length(), vectWeight.length());
-
-  //////////////////////////////////
-  /////////// GRAPH COPY ///////////
-  //////////////////////////////////
+//####### graphCopy #######////####### graphCopy #######////####### graphCopy #######//
+//####### graphCopy #######////####### graphCopy #######////####### graphCopy #######//
+/// the Graph of the dataframe mygraph (9 variables)
 
+Graph graphCopy(DataFrame mygraph)
+{
   Graph graph = Graph();
   Edge newedge;
 
@@ -93,49 +420,137 @@ List gfpopTransfer(NumericVector vectData, DataFrame mygraph, std::string type,
   for(int i = 0 ; i < mygraph.nrow(); i++)
     {graph << Edge(state1[i], state2[i], typeEdge[i], fabs(parameter[i]), penalty[i], fabs(KK[i]), fabs(aa[i]), minn[i], maxx[i]);}
 
-  // END TRANSFERT into C++ objects  // END TRANSFERT into C++ objects  // END TRANSFERT into C++ objects
-  // END TRANSFERT into C++ objects  // END TRANSFERT into C++ objects  // END TRANSFERT into C++ objects
+  return(graph);
+}
 
-  /////////////////////////////////////////////
-  /////////// COST FUNCTION LOADING ///////////
-  /////////////////////////////////////////////
+// [[Rcpp::export]]
+List gfpopTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight, std::string storage, unsigned int checkpoint, std::string file, unsigned int nthreads)
+{
+  ///////////////////////////////////////////
+  /////////// DATA TRANSFORMATION ///////////
+  ///////////////////////////////////////////
+  dataTransformation(vectData, type);
 
-  cost_coeff = coeff_factory(type);
-  cost_eval = eval_factory(type);
+  // BEGIN TRANSFERT into C++ objects  // BEGIN TRANSFERT into C++ objects  // BEGIN TRANSFERT into C++ objects
+  // BEGIN TRANSFERT into C++ objects  // BEGIN TRANSFERT into C++ objects  // BEGIN TRANSFERT into C++ objects
+  // DATA AND GRAPH
 
-  cost_min = min_factory(type);
-  cost_minInterval = minInterval_factory(type);
-  cost_argmin = argmin_factory(type);
-  cost_argminInterval = argminInterval_factory(type);
-  cost_argminBacktrack = argminBacktrack_factory(type);
+  /////////////////////////////////
+  /////////// DATA COPY ///////////
+  /////////////////////////////////
+  Data data = Data();
+  data.copy(vectData, vectWeight, vectData.length(), vectWeight.length());
 
-  cost_shift = shift_factory(type);
-  cost_interShift = interShift_factory(type);
-  cost_expDecay = expDecay_factory(type);
-  cost_interExpDecay = interExpDecay_factory(type);
+  //////////////////////////////////
+  /////////// GRAPH COPY ///////////
+  //////////////////////////////////
+  Graph graph = graphCopy(mygraph);
 
-  cost_intervalInterRoots = intervalInterRoots_factory(type);
-  cost_age = age_factory(type);
-  cost_interval = interval_factory(type);
+  // END TRANSFERT into C++ objects  // END TRANSFERT into C++ objects  // END TRANSFERT into C++ objects
+  // END TRANSFERT into C++ objects  // END TRANSFERT into C++ objects  // END TRANSFERT into C++ objects
 
   /////////////////////////////
   /////////// OMEGA ///////////
   /////////////////////////////
+  /// the cost model is chosen once here: Omega and the Piece operations are compiled for it
 
-  Omega omega(graph);
-  omega.gfpop(data);
+  List res;
+  if(type == "mean"){res = gfpopOmega<MeanCost>(graph, data, storage, checkpoint, file, nthreads);}
+  if(type == "variance"){res = gfpopOmega<VarianceCost>(graph, data, storage, checkpoint, file, nthreads);}
+  if(type == "poisson"){res = gfpopOmega<PoissonCost>(graph, data, storage, checkpoint, file, nthreads);}
+  if(type == "exp"){res = gfpopOmega<ExpCost>(graph, data, storage, checkpoint, file, nthreads);}
+  if(type == "negbin"){res = gfpopOmega<NegbinCost>(graph, data, storage, checkpoint, file, nthreads);}
 
-  /////////////////////////////
-  /////////// RETURN //////////
-  /////////////////////////////
+  return res;
+}
 
-  List res = List::create(
-    _["changepoints"] = omega.GetChangepoints(),
-    _["states"] = omega.GetStates(),
-    _["forced"] = omega.GetForced(),
-    _["param"] = omega.GetParameters(),
-    _["cost"] = omega.GetGlobalCost()
-);
+// [[Rcpp::export]]
+List gfpopBatchTransfer(List listData, DataFrame mygraph, std::string type, List listWeight, std::string storage, unsigned int checkpoint, unsigned int nthreads)
+{
+  /// the R objects are only used here (not in the threads)
+  unsigned int m = listData.size();
+  std::vector<Data*> data(m, NULL);
+  List res;
+  try
+  {
+    for(unsigned int i = 0; i < m; i++)
+    {
+      NumericVector vectData = clone(as<NumericVector>(listData[i])); ///the transformation does not modify the series of the user
+      NumericVector vectWeight = listWeight[i];
+      dataTransformation(vectData, type);
+      data[i] = new Data();
+      data[i]->copy(vectData, vectWeight, vectData.length(), vectWeight.length());
+    }
+    Graph graph = graphCopy(mygraph);
+
+    if(type == "mean"){res = gfpopBatchOmega<MeanCost>(graph, data, storage, checkpoint, nthreads);}
+    if(type == "variance"){res = gfpopBatchOmega<VarianceCost>(graph, data, storage, checkpoint, nthreads);}
+    if(type == "poisson"){res = gfpopBatchOmega<PoissonCost>(graph, data, storage, checkpoint, nthreads);}
+    if(type == "exp"){res = gfpopBatchOmega<ExpCost>(graph, data, storage, checkpoint, nthreads);}
+    if(type == "negbin"){res = gfpopBatchOmega<NegbinCost>(graph, data, storage, checkpoint, nthreads);}
+  }
+  catch(...)
+  {
+    for(unsigned int i = 0; i < m; i++){delete data[i];}
+    throw;
+  }
+
+  for(unsigned int i = 0; i < m; i++){delete data[i];}
+  return res;
+}
+
+// [[Rcpp::export]]
+List gfpopGridTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight, NumericVector multipliers, std::string storage, unsigned int checkpoint, bool segmentations, unsigned int nthreads)
+{
+  dataTransformation(vectData, type);
+  Data data = Data();
+  data.copy(vectData, vectWeight, vectData.length(), vectWeight.length());
+  Graph graph = graphCopy(mygraph);
+  std::vector<double> mult(multipliers.begin(), multipliers.end());
+
+  List res;
+  if(type == "mean"){res = gfpopGridOmega<MeanCost>(graph, data, mult, storage, checkpoint, segmentations, nthreads);}
+  if(type == "variance"){res = gfpopGridOmega<VarianceCost>(graph, data, mult, storage, checkpoint, segmentations, nthreads);}
+  if(type == "poisson"){res = gfpopGridOmega<PoissonCost>(graph, data, mult, storage, checkpoint, segmentations, nthreads);}
+  if(type == "exp"){res = gfpopGridOmega<ExpCost>(graph, data, mult, storage, checkpoint, segmentations, nthreads);}
+  if(type == "negbin"){res = gfpopGridOmega<NegbinCost>(graph, data, mult, storage, checkpoint, segmentations, nthreads);}
+
+  return res;
+}
+
+// [[Rcpp::export]]
+List gfpopCropsTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight, double minMultiplier, double maxMultiplier, std::string storage, unsigned int checkpoint, unsigned int nthreads)
+{
+  if(!(minMultiplier > 0) || !(maxMultiplier >= minMultiplier)){throw std::range_error("The penalty range has to be an interval of positive values");}
+  dataTransformation(vectData, type);
+  Data data = Data();
+  data.copy(vectData, vectWeight, vectData.length(), vectWeight.length());
+  Graph graph = graphCopy(mygraph);
+
+  List res;
+  if(type == "mean"){res = gfpopCropsOmega<MeanCost>(graph, data, minMultiplier, maxMultiplier, storage, checkpoint, nthreads);}
+  if(type == "variance"){res = gfpopCropsOmega<VarianceCost>(graph, data, minMultiplier, maxMultiplier, storage, checkpoint, nthreads);}
+  if(type == "poisson"){res = gfpopCropsOmega<PoissonCost>(graph, data, minMultiplier, maxMultiplier, storage, checkpoint, nthreads);}
+  if(type == "exp"){res = gfpopCropsOmega<ExpCost>(graph, data, minMultiplier, maxMultiplier, storage, checkpoint, nthreads);}
+  if(type == "negbin"){res = gfpopCropsOmega<NegbinCost>(graph, data, minMultiplier, maxMultiplier, storage, checkpoint, nthreads);}
+
+  return res;
+}
+
+// [[Rcpp::export]]
+List itergfpopTransfer(NumericVector vectData, DataFrame mygraph, std::string type, NumericVector vectWeight, unsigned int iterMax, unsigned int Dinit, unsigned int nthreads)
+{
+  dataTransformation(vectData, type);
+  Data data = Data();
+  data.copy(vectData, vectWeight, vectData.length(), vectWeight.length());
+  Graph graph = graphCopy(mygraph);
+
+  List res;
+  if(type == "mean"){res = gfpopIterOmega<MeanCost>(graph, data, iterMax, Dinit, nthreads);}
+  if(type == "variance"){res = gfpopIterOmega<VarianceCost>(graph, data, iterMax, Dinit, nthreads);}
+  if(type == "poisson"){res = gfpopIterOmega<PoissonCost>(graph, data, iterMax, Dinit, nthreads);}
+  if(type == "exp"){res = gfpopIterOmega<ExpCost>(graph, data, iterMax, Dinit, nthreads);}
+  if(type == "negbin"){res = gfpopIterOmega<NegbinCost>(graph, data, iterMax, Dinit, nthreads);}
 
   return res;
 }